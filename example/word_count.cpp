@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// This example counts the lines and words of a file on all the cores of
+// the machine, like a parallel `wc -lw`. The file is mapped into memory,
+// cut into one piece per thread with view::partition_lines, and each
+// thread reads its piece with getlines and view::split. Since the pieces
+// are cut at line boundaries, no line or word is split between threads,
+// and the counts are the same as those of a single pass over the file.
+//
+// Run without arguments, it counts some text of its own both ways and
+// checks that the answers agree.
+
+#include <cctype>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include <range/v3/view/mapped_file.hpp>
+
+using namespace ranges;
+
+struct counts
+{
+    long lines = 0, words = 0;
+};
+
+counts count_words(range<char const *> text)
+{
+    auto is_space = [](char const *cur, char const *)
+    {
+        return std::make_pair(0 != std::isspace(static_cast<unsigned char>(*cur)), 1L);
+    };
+    counts c;
+    RANGES_FOR(auto line, getlines(text))
+    {
+        ++c.lines;
+        RANGES_FOR(auto word, line | view::split(is_space))
+            c.words += !empty(word);
+    }
+    return c;
+}
+
+template<typename Buffer>
+counts parallel_count(Buffer const &buf, std::size_t nthreads)
+{
+    auto pieces = view::partition_lines(buf, nthreads);
+    std::vector<counts> results(size(pieces));
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < size(pieces); ++i)
+        threads.emplace_back([&, i]{ results[i] = count_words(pieces[static_cast<std::ptrdiff_t>(i)]); });
+    for(auto &t : threads)
+        t.join();
+    counts total;
+    for(auto c : results)
+    {
+        total.lines += c.lines;
+        total.words += c.words;
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const nthreads = std::max(std::thread::hardware_concurrency(), 1u);
+    if(argc > 1)
+    {
+        auto file = view::mapped_file(argv[1], mapped_file_hint::sequential);
+        counts c = parallel_count(file, nthreads);
+        std::cout << c.lines << ' ' << c.words << ' ' << argv[1] << '\n';
+        return 0;
+    }
+
+    std::string text;
+    for(int i = 0; i < 1000; ++i)
+        text += "The quick brown fox\tjumps over\n\nthe  lazy dog " + std::to_string(i) + "\r\n";
+    counts const seq = count_words({text.data(), text.data() + text.size()});
+    for(std::size_t n : {1u, 2u, 3u, 7u, 64u})
+    {
+        counts const par = parallel_count(text, n);
+        if(par.lines != seq.lines || par.words != seq.words)
+        {
+            std::cerr << "Mismatch with " << n << " threads: " << par.lines << ' '
+                      << par.words << " != " << seq.lines << ' ' << seq.words << '\n';
+            return 1;
+        }
+    }
+    std::cout << seq.lines << ' ' << seq.words << '\n';
+    return seq.lines == 3000 && seq.words == 10000 ? 0 : 1;
+}
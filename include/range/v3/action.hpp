@@ -15,9 +15,11 @@
 #define RANGES_V3_ACTION_HPP
 
 #include <range/v3/action/concepts.hpp>
+#include <range/v3/action/distinct.hpp>
 #include <range/v3/action/drop.hpp>
 #include <range/v3/action/drop_while.hpp>
 #include <range/v3/action/erase.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/action/insert.hpp>
 #include <range/v3/action/join.hpp>
 #include <range/v3/action/push_back.hpp>
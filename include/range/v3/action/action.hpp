@@ -42,6 +42,19 @@ namespace ranges
                         A::bind(std::forward<Ts>(ts)...)
                     )
                 };
+
+                template<typename I, typename Fn, typename...Args>
+                static auto runner(Args const &...args)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    Fn::template runner<I>(args...)
+                )
+
+                template<typename Action>
+                static Action const &get(action<Action> const &act)
+                {
+                    return act.action_;
+                }
             };
 
             struct make_action_fn
@@ -66,6 +79,7 @@ namespace ranges
             private:
                 Action action_;
                 friend pipeable_access;
+                friend action_access;
                 template<typename Rng>
                 using ActionPipeConcept = meta::and_<
                     Function<Action, Rng>,
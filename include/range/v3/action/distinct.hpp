@@ -0,0 +1,181 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_DISTINCT_HPP
+#define RANGES_V3_ACTION_DISTINCT_HPP
+
+#include <tuple>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_set.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-actions
+        /// @{
+        namespace action
+        {
+            /// Removes every element whose key, the element itself or its projection,
+            /// was the key of an element before it, leaving the first of each in the
+            /// order they came. Keys are hashed with \c H, `std::hash` by default, and
+            /// compared with `==`. Unlike \c unique, the range needn't be sorted, and
+            /// it takes one pass; each distinct key is copied into a hash set.
+            struct distinct_fn
+            {
+            private:
+                friend action_access;
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                template<typename P, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(!Range<P>::value)>
+#else
+                template<typename P, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(!Range<P>())>
+#endif
+                static auto bind(distinct_fn distinct, P proj, H hash = H{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    detail::fusable_step<distinct_fn, P, H>{std::move(proj), std::move(hash)}
+                )
+                template<typename I, typename P>
+                using key_t = iterator_value_t<Project<I, P>>;
+
+                template<typename I, typename P, typename H>
+                struct fused_runner
+                {
+                    P proj_;
+                    detail::hash_set_<key_t<I, P>, H> seen_;
+                    detail::fuse_op operator()(I const &it, I const &)
+                    {
+                        return seen_.insert(as_function(proj_)(*it)) ?
+                            detail::fuse_op::keep : detail::fuse_op::drop;
+                    }
+                };
+                template<typename I, typename P, typename H>
+                static fused_runner<I, P, H> runner(P const &proj, H const &hash)
+                {
+                    return {proj, detail::hash_set_<key_t<I, P>, H>{hash}};
+                }
+            public:
+                struct ConceptImpl
+                {
+                    template<typename Rng, typename P = ident, typename H = detail::default_hash_,
+                        typename I = range_iterator_t<Rng>,
+                        typename S = range_sentinel_t<Rng>,
+                        typename K = key_t<I, P>>
+                    auto requires_(Rng&&, P&& = P{}, H&& = H{}) -> decltype(
+                        concepts::valid_expr(
+                            concepts::model_of<concepts::ForwardRange, Rng>(),
+                            concepts::model_of<concepts::ErasableRange, Rng, I, S>(),
+                            concepts::is_true(Permutable<I>()),
+                            concepts::model_of<concepts::EqualityComparable, K>(),
+                            concepts::is_true(Function<function_type<H>, K const &>())
+                        ));
+                };
+
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_>
+                using Concept = concepts::models<ConceptImpl, Rng, P, H>;
+
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_,
+                    typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rng, P, H>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rng, P, H>())>
+#endif
+                Rng operator()(Rng && rng, P proj_ = P{}, H hash = H{}) const
+                {
+                    detail::hash_set_<key_t<I, P>, H> seen{std::move(hash)};
+                    auto &&proj = as_function(proj_);
+                    auto const end = ranges::end(rng);
+                    I out = ranges::begin(rng);
+                    for(I in = out; in != end; ++in)
+                    {
+                        if(!seen.insert(proj(*in)))
+                            continue;
+                        if(out != in)
+                            *out = iter_move(in);
+                        ++out;
+                    }
+                    ranges::action::erase(rng, out, end);
+                    return std::forward<Rng>(rng);
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rng, P, H>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rng, P, H>())>
+#endif
+                void operator()(Rng &&, P && = P{}, H && = H{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which action::distinct operates must be a model of the "
+                        "ForwardRange concept.");
+                    using I = range_iterator_t<Rng>;
+                    using S = range_sentinel_t<Rng>;
+                    CONCEPT_ASSERT_MSG(ErasableRange<Rng, I, S>(),
+                        "The object on which action::distinct operates must allow element "
+                        "removal.");
+                    CONCEPT_ASSERT_MSG(Projectable<I, P>(),
+                        "The projection function must accept objects of the iterator's value type, "
+                        "reference type, and rvalue reference type.");
+                    CONCEPT_ASSERT_MSG(Permutable<I>(),
+                        "The iterator type of the range passed to action::distinct must allow its "
+                        "elements to be permuted; that is, the values must be movable and the "
+                        "iterator must be mutable.");
+                }
+            #endif
+            };
+
+            /// \ingroup group-actions
+            /// \relates distinct_fn
+            /// \sa action
+            namespace
+            {
+                constexpr auto&& distinct = static_const<action<distinct_fn>>::value;
+            }
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // action::distinct can be fused without arguments.
+            template<>
+            struct fused_steps<action::distinct_fn>
+            {
+                using type = std::tuple<fusable_step<action::distinct_fn, ident, default_hash_>>;
+                static type get(action::distinct_fn)
+                {
+                    return type{fusable_step<action::distinct_fn, ident, default_hash_>{{}, {}}};
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
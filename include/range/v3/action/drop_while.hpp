@@ -18,6 +18,7 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/action/erase.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -45,8 +46,27 @@ namespace ranges
                 static auto bind(drop_while_fn drop_while, Fun fun)
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(drop_while, std::placeholders::_1, std::move(fun))
+                    detail::fusable_step<drop_while_fn, Fun>{std::move(fun)}
                 )
+                template<typename Fun>
+                struct fused_runner
+                {
+                    Fun fun_;
+                    bool dropping_;
+                    template<typename I>
+                    detail::fuse_op operator()(I const &it, I const &)
+                    {
+                        if(dropping_ && as_function(fun_)(*it))
+                            return detail::fuse_op::drop;
+                        dropping_ = false;
+                        return detail::fuse_op::keep;
+                    }
+                };
+                template<typename I, typename Fun>
+                static fused_runner<Fun> runner(Fun const &fun)
+                {
+                    return {fun, true};
+                }
             public:
                 struct ConceptImpl
                 {
@@ -0,0 +1,303 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_FUSED_HPP
+#define RANGES_V3_ACTION_FUSED_HPP
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // What a step of a fused action does with the element in front of it.
+            enum class fuse_op
+            {
+                keep,   // pass it on to the next step
+                drop,   // remove it
+                stop    // remove it and everything after it
+            };
+
+            // An element-wise action with its arguments bound, as returned by the
+            // action's bind. Applied on its own, it is the action. Composed with other
+            // steps, it provides a runner: a function object, with any state it needs
+            // for one pass, that is called with an iterator to each element in turn and
+            // the position the element is moved to if it is kept, and returns a
+            // fuse_op. Runners may modify the element.
+            template<typename Fn, typename...Args>
+            struct fusable_step
+            {
+            private:
+                std::tuple<Args...> args_;
+                template<typename Rng, std::size_t...Is>
+                static auto apply_(std::tuple<Args...> const &args, Rng &&rng,
+                    meta::index_sequence<Is...>)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    Fn{}(std::forward<Rng>(rng), std::get<Is>(args)...)
+                )
+                template<typename I, std::size_t...Is>
+                static auto runner_(std::tuple<Args...> const &args, meta::index_sequence<Is...>)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    action::action_access::runner<I, Fn>(std::get<Is>(args)...)
+                )
+            public:
+                fusable_step() = default;
+                explicit fusable_step(Args...args)
+                  : args_(std::move(args)...)
+                {}
+                template<typename Rng>
+                auto operator()(Rng &&rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    fusable_step::apply_(args_, std::forward<Rng>(rng),
+                        meta::make_index_sequence<sizeof...(Args)>{})
+                )
+                template<typename I>
+                auto runner() const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    fusable_step::runner_<I>(args_, meta::make_index_sequence<sizeof...(Args)>{})
+                )
+            };
+
+            template<std::size_t N, std::size_t Size>
+            struct fused_steps_
+            {
+                // Applies the steps one after the other, as actions.
+                template<typename Rng, typename Steps>
+                static auto apply(Rng &&rng, Steps const &steps)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    fused_steps_<N + 1, Size>::apply(std::get<N>(steps)(std::forward<Rng>(rng)),
+                        steps)
+                )
+                // Runs the element through the runners until one doesn't keep it.
+                template<typename I, typename Runners>
+                static fuse_op run(I const &it, I const &out, Runners &runners)
+                {
+                    fuse_op const op = std::get<N>(runners)(it, out);
+                    return fuse_op::keep == op ?
+                        fused_steps_<N + 1, Size>::run(it, out, runners) : op;
+                }
+            };
+
+            template<std::size_t Size>
+            struct fused_steps_<Size, Size>
+            {
+                template<typename Rng, typename Steps>
+                static Rng apply(Rng &&rng, Steps const &)
+                {
+                    return std::forward<Rng>(rng);
+                }
+                template<typename I, typename Runners>
+                static fuse_op run(I const &, I const &, Runners &)
+                {
+                    return fuse_op::keep;
+                }
+            };
+
+            // Whether a step compares elements with ones it kept before, at the
+            // positions they were moved to. Then it ends the pass it is in, so that
+            // what it keeps is not changed by the steps after it, which make another
+            // pass over what is left.
+            template<typename Step>
+            struct fuse_ends_pass
+              : std::false_type
+            {};
+
+            // Two or more element-wise actions composed with `|`. On a range that
+            // allows it, they run together in a single pass that moves the elements
+            // that survive all the steps to the front, followed by a single erase.
+            // A step that ends a pass, like unique, is the last of its pass, and the
+            // steps after it make another over the elements it moved to the front.
+            // On any other range they run one after the other.
+            template<typename...Steps>
+            struct fused_action
+            {
+            private:
+                std::tuple<Steps...> steps_;
+
+                template<typename I, typename = void>
+                struct has_runners_
+                  : std::false_type
+                {};
+                template<typename I>
+                struct has_runners_<I, meta::void_<
+                    decltype(std::declval<Steps const &>().template runner<I>())...>>
+                  : std::true_type
+                {};
+                // The end of the pass that begins with step From.
+                template<std::size_t From, typename = void>
+                struct pass_end_
+                  : meta::if_<fuse_ends_pass<meta::at_c<meta::list<Steps...>, From>>,
+                        meta::size_t<From + 1>, pass_end_<From + 1>>
+                {};
+                template<typename Dummy>
+                struct pass_end_<sizeof...(Steps), Dummy>
+                  : meta::size_t<sizeof...(Steps)>
+                {};
+                template<typename Rng, typename I = range_iterator_t<Rng>>
+                using SinglePass = meta::and_<
+                    ForwardRange<Rng>,
+                    ErasableRange<Rng, I, range_sentinel_t<Rng>>,
+                    Permutable<I>,
+                    has_runners_<I>>;
+            public:
+                fused_action() = default;
+                explicit fused_action(std::tuple<Steps...> steps)
+                  : steps_(std::move(steps))
+                {}
+                std::tuple<Steps...> const &steps() const
+                {
+                    return steps_;
+                }
+                template<typename Rng, typename I = range_iterator_t<Rng>,
+                    CONCEPT_REQUIRES_(SinglePass<Rng>::value)>
+                Rng operator()(Rng &&rng) const
+                {
+                    auto runners = runners_<I>(meta::make_index_sequence<sizeof...(Steps)>{});
+                    I const out = fused_action::run_<0>(ranges::begin(rng), ranges::end(rng),
+                        runners);
+                    ranges::action::erase(rng, out, ranges::end(rng));
+                    return std::forward<Rng>(rng);
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!SinglePass<Rng>::value)>
+                auto operator()(Rng &&rng) const ->
+                    decltype(fused_steps_<0, sizeof...(Steps)>::apply(std::forward<Rng>(rng),
+                        std::declval<std::tuple<Steps...> const &>()))
+                {
+                    return fused_steps_<0, sizeof...(Steps)>::apply(std::forward<Rng>(rng),
+                        steps_);
+                }
+            private:
+                // Makes the pass that begins with step From over [first, last), and
+                // the ones after it over what it leaves, and returns the end of that.
+                template<std::size_t From, typename I, typename S, typename Runners,
+                    CONCEPT_REQUIRES_(From != sizeof...(Steps))>
+                static I run_(I const first, S const last, Runners &runners)
+                {
+                    using end_t = pass_end_<From>;
+                    I out = first, in = first;
+                    for(; in != last; ++in)
+                    {
+                        fuse_op const op = fused_steps_<From, end_t::value>::run(in, out,
+                            runners);
+                        if(fuse_op::stop == op)
+                            break;
+                        if(fuse_op::keep == op)
+                        {
+                            if(out != in)
+                                *out = iter_move(in);
+                            ++out;
+                        }
+                    }
+                    return fused_action::run_<end_t::value>(first, out, runners);
+                }
+                template<std::size_t From, typename I, typename Runners,
+                    CONCEPT_REQUIRES_(From == sizeof...(Steps))>
+                static I run_(I const, I const last, Runners &)
+                {
+                    return last;
+                }
+                template<typename I, std::size_t...Is>
+                std::tuple<decltype(std::declval<Steps const &>().template runner<I>())...>
+                runners_(meta::index_sequence<Is...>) const
+                {
+                    return std::make_tuple(std::get<Is>(steps_).template runner<I>()...);
+                }
+            };
+
+            // The steps of an action that can be fused, as a tuple.
+            template<typename Action>
+            struct fused_steps
+            {};
+
+            template<typename Fn, typename...Args>
+            struct fused_steps<fusable_step<Fn, Args...>>
+            {
+                using type = std::tuple<fusable_step<Fn, Args...>>;
+                static type get(fusable_step<Fn, Args...> const &step)
+                {
+                    return type{step};
+                }
+            };
+
+            template<typename...Steps>
+            struct fused_steps<fused_action<Steps...>>
+            {
+                using type = std::tuple<Steps...>;
+                static type get(fused_action<Steps...> const &act)
+                {
+                    return act.steps();
+                }
+            };
+
+            template<typename Steps0, typename Steps1>
+            struct fused_action_cat_;
+
+            template<typename...Steps0, typename...Steps1>
+            struct fused_action_cat_<std::tuple<Steps0...>, std::tuple<Steps1...>>
+            {
+                using type = fused_action<Steps0..., Steps1...>;
+            };
+        }
+        /// \endcond
+
+        namespace action
+        {
+            /// \addtogroup group-actions
+            /// @{
+
+            /// Composes two element-wise actions -- `transform`, `remove_if`, `unique`,
+            /// `take_while`, `drop_while` and `stride`, with their arguments -- into one
+            /// that makes a single pass over the range and erases once, rather than
+            /// one pass and one erase per action. So
+            /// `v |= action::transform(f) | action::remove_if(p) | action::unique`
+            /// reads and writes each element of \c v once. \c unique compares with the
+            /// elements it kept where they were moved to, so the actions after it make
+            /// a second pass, over what is left. Note that `v | a | b` applies
+            /// \c a to \c v before \c b is considered, so it isn't fused; `v | (a | b)` is.
+            template<typename A0, typename A1,
+                typename S0 = meta::_t<detail::fused_steps<A0>>,
+                typename S1 = meta::_t<detail::fused_steps<A1>>>
+            action<meta::_t<detail::fused_action_cat_<S0, S1>>>
+            operator|(action<A0> a0, action<A1> a1)
+            {
+                using Act = meta::_t<detail::fused_action_cat_<S0, S1>>;
+                return action<Act>{Act{std::tuple_cat(
+                    detail::fused_steps<A0>::get(action_access::get(a0)),
+                    detail::fused_steps<A1>::get(action_access::get(a1)))}};
+            }
+            /// @}
+        }
+    }
+}
+
+#endif
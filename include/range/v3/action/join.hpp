@@ -15,9 +15,12 @@
 #define RANGES_V3_ACTION_JOIN_HPP
 
 #include <vector>
+#include <type_traits>
 #include <functional>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_concepts.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -47,6 +50,27 @@ namespace ranges
 #endif
                         range_value_t<Rng>,
                         std::vector<range_value_t<range_value_t<Rng>>>>;
+
+                // The inner ranges can be sized without being computed twice.
+                template<typename Rng>
+                using PresizeConcept = meta::and_<
+                    ForwardRange<Rng>,
+                    std::is_lvalue_reference<range_reference_t<Rng>>,
+                    SizedRange<range_reference_t<Rng>>,
+                    Reservable<join_value_t<Rng>>>;
+
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &c, Rng &rng, std::true_type)
+                {
+                    range_size_t<Cont> n = 0;
+                    auto end = ranges::end(rng);
+                    for(auto it = begin(rng); it != end; ++it)
+                        n += static_cast<range_size_t<Cont>>(size(*it));
+                    c.reserve(n);
+                }
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &, Rng &, std::false_type)
+                {}
             public:
                 template<typename Rng>
                 using Concept = meta::and_<
@@ -63,6 +87,7 @@ namespace ranges
                 join_value_t<Rng> operator()(Rng && rng) const
                 {
                     join_value_t<Rng> ret;
+                    join_fn::reserve_(ret, rng, PresizeConcept<Rng>());
                     auto end = ranges::end(rng);
                     for(auto it = begin(rng); it != end; ++it)
                         push_back(ret, *it);
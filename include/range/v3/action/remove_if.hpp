@@ -19,6 +19,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/action/erase.hpp>
 #include <range/v3/algorithm/remove_if.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -45,9 +46,25 @@ namespace ranges
                 static auto bind(remove_if_fn remove_if, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(remove_if, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::fusable_step<remove_if_fn, C, P>{std::move(pred), std::move(proj)}
                 )
+                template<typename C, typename P>
+                struct fused_runner
+                {
+                    C pred_;
+                    P proj_;
+                    template<typename I>
+                    detail::fuse_op operator()(I const &it, I const &)
+                    {
+                        return as_function(pred_)(as_function(proj_)(*it)) ?
+                            detail::fuse_op::drop : detail::fuse_op::keep;
+                    }
+                };
+                template<typename I, typename C, typename P>
+                static fused_runner<C, P> runner(C const &pred, P const &proj)
+                {
+                    return {pred, proj};
+                }
             public:
                 struct ConceptImpl
                 {
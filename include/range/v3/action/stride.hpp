@@ -17,6 +17,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/action/erase.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -43,8 +44,30 @@ namespace ranges
                 static auto bind(stride_fn stride, D step)
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(stride, std::placeholders::_1, step)
+                    detail::fusable_step<stride_fn, D>{step}
                 )
+                template<typename D>
+                struct fused_runner
+                {
+                    D step_, skip_;
+                    template<typename I>
+                    detail::fuse_op operator()(I const &, I const &)
+                    {
+                        if(0 != skip_)
+                        {
+                            --skip_;
+                            return detail::fuse_op::drop;
+                        }
+                        skip_ = step_ - 1;
+                        return detail::fuse_op::keep;
+                    }
+                };
+                template<typename I, typename T, typename D = iterator_difference_t<I>>
+                static fused_runner<D> runner(T const &step)
+                {
+                    RANGES_ASSERT(0 < step);
+                    return {static_cast<D>(step), 0};
+                }
             public:
                 struct ConceptImpl
                 {
@@ -17,6 +17,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -43,9 +44,25 @@ namespace ranges
                 static auto bind(transform_fn transform, F fun, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(transform, std::placeholders::_1, protect(std::move(fun)),
-                        protect(std::move(proj)))
+                    detail::fusable_step<transform_fn, F, P>{std::move(fun), std::move(proj)}
                 )
+                template<typename F, typename P>
+                struct fused_runner
+                {
+                    F fun_;
+                    P proj_;
+                    template<typename I>
+                    detail::fuse_op operator()(I const &it, I const &)
+                    {
+                        *it = as_function(fun_)(as_function(proj_)(*it));
+                        return detail::fuse_op::keep;
+                    }
+                };
+                template<typename I, typename F, typename P>
+                static fused_runner<F, P> runner(F const &fun, P const &proj)
+                {
+                    return {fun, proj};
+                }
             public:
                 struct ConceptImpl
                 {
@@ -17,8 +17,10 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/fused.hpp>
 #include <range/v3/action/erase.hpp>
 #include <range/v3/algorithm/unique.hpp>
+#include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -42,9 +44,32 @@ namespace ranges
                 static auto bind(unique_fn unique, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(unique, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::fusable_step<unique_fn, C, P>{std::move(pred), std::move(proj)}
                 )
+                // Compares each element with the last one it kept, where the pass
+                // moved it to. unique ends the pass, so nothing changes it there.
+                template<typename I, typename C, typename P>
+                struct fused_runner
+                {
+                    C pred_;
+                    P proj_;
+                    I last_;
+                    bool first_;
+                    detail::fuse_op operator()(I const &it, I const &out)
+                    {
+                        auto &&proj = as_function(proj_);
+                        if(!first_ && as_function(pred_)(proj(*last_), proj(*it)))
+                            return detail::fuse_op::drop;
+                        last_ = out;
+                        first_ = false;
+                        return detail::fuse_op::keep;
+                    }
+                };
+                template<typename I, typename C, typename P>
+                static fused_runner<I, C, P> runner(C const &pred, P const &proj)
+                {
+                    return {pred, proj, I{}, true};
+                }
             public:
                 struct ConceptImpl
                 {
@@ -117,6 +142,27 @@ namespace ranges
             }
         }
         /// @}
+
+        /// \cond
+        namespace detail
+        {
+            template<typename...Args>
+            struct fuse_ends_pass<fusable_step<action::unique_fn, Args...>>
+              : std::true_type
+            {};
+
+            // action::unique can be fused without arguments.
+            template<>
+            struct fused_steps<action::unique_fn>
+            {
+                using type = std::tuple<fusable_step<action::unique_fn, equal_to, ident>>;
+                static type get(action::unique_fn)
+                {
+                    return type{fusable_step<action::unique_fn, equal_to, ident>{{}, {}}};
+                }
+            };
+        }
+        /// \endcond
     }
 }
 
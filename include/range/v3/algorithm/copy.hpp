@@ -17,6 +17,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -31,6 +32,24 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename O>
+            struct copy_sink
+            {
+                O &out_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    *out_ = static_cast<T &&>(t);
+                    ++out_;
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct copy_fn : aux::copy_fn
@@ -63,13 +82,13 @@ namespace ranges
                 typename I = range_iterator_t<Rng>,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(
-                    InputRange<Rng>::value &&
+                    InputRange<Rng>::value && !BoundedRange<Rng>::value &&
                     WeaklyIncrementable<O>::value &&
                     IndirectlyCopyable<I, O>::value
                 )>
 #else
                 CONCEPT_REQUIRES_(
-                    InputRange<Rng>() &&
+                    InputRange<Rng>() && !BoundedRange<Rng>() &&
                     WeaklyIncrementable<O>() &&
                     IndirectlyCopyable<I, O>()
                 )>
@@ -79,6 +98,29 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(out));
             }
+
+            /// \overload
+            template<typename Rng, typename O,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(
+                    InputRange<Rng>::value && BoundedRange<Rng>::value &&
+                    WeaklyIncrementable<O>::value &&
+                    IndirectlyCopyable<I, O>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(
+                    InputRange<Rng>() && BoundedRange<Rng>() &&
+                    WeaklyIncrementable<O>() &&
+                    IndirectlyCopyable<I, O>()
+                )>
+#endif
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(Rng &&rng, O out) const
+            {
+                ranges::for_each_while(rng, detail::copy_sink<O>{out});
+                return {end(rng), out};
+            }
         };
 
         /// \sa `copy_fn`
@@ -16,6 +16,7 @@
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -27,6 +28,26 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename D, typename R, typename P>
+            struct count_if_sink
+            {
+                D &n_;
+                R &pred_;
+                P &proj_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    if(pred_(proj_(static_cast<T &&>(t))))
+                        ++n_;
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct count_if_fn
@@ -59,9 +80,14 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputRange<Rng>() && IndirectCallablePredicate<R, Project<I, P> >())>
 #endif
             iterator_difference_t<I>
-            operator()(Rng &&rng, R pred, P proj = P{}) const
+            operator()(Rng &&rng, R pred_, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                iterator_difference_t<I> n = 0;
+                ranges::for_each_while(rng, detail::count_if_sink<iterator_difference_t<I>,
+                    uncvref_t<decltype(pred)>, uncvref_t<decltype(proj)>>{n, pred, proj});
+                return n;
             }
         };
 
@@ -16,6 +16,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -28,6 +29,24 @@ namespace ranges
     {
         /// \addtogroup group-algorithms
         /// @{
+        /// \cond
+        namespace detail
+        {
+            template<typename F, typename P>
+            struct for_each_sink
+            {
+                F &fun_;
+                P &proj_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    fun_(proj_(static_cast<T &&>(t)));
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
         struct for_each_fn
         {
             template<typename I, typename S, typename F, typename P = ident,
@@ -52,14 +71,38 @@ namespace ranges
             template<typename Rng, typename F, typename P = ident,
                 typename I = range_iterator_t<Rng>,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                CONCEPT_REQUIRES_(InputRange<Rng>::value && IndirectCallable<F, Project<I, P>>::value)>
+                CONCEPT_REQUIRES_(InputRange<Rng>::value && !BoundedRange<Rng>::value &&
+                    IndirectCallable<F, Project<I, P>>::value)>
 #else
-                CONCEPT_REQUIRES_(InputRange<Rng>() && IndirectCallable<F, Project<I, P>>())>
+                CONCEPT_REQUIRES_(InputRange<Rng>() && !BoundedRange<Rng>() &&
+                    IndirectCallable<F, Project<I, P>>())>
 #endif
             range_safe_iterator_t<Rng> operator()(Rng &&rng, F fun, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(fun), std::move(proj));
             }
+
+            /// \overload
+            /// The end iterator of a bounded range is known up front, so the range can
+            /// push its elements through internal iteration.
+            template<typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value && BoundedRange<Rng>::value &&
+                    IndirectCallable<F, Project<I, P>>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>() && BoundedRange<Rng>() &&
+                    IndirectCallable<F, Project<I, P>>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, F fun_, P proj_ = P{}) const
+            {
+                auto &&fun = as_function(fun_);
+                auto &&proj = as_function(proj_);
+                ranges::for_each_while(rng,
+                    detail::for_each_sink<uncvref_t<decltype(fun)>, uncvref_t<decltype(proj)>>{
+                        fun, proj});
+                return end(rng);
+            }
         };
 
         /// \sa `for_each_fn`
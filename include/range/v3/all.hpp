@@ -17,6 +17,9 @@
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm.hpp>
 #include <range/v3/action.hpp>
+#include <range/v3/eytzinger_index.hpp>
+#include <range/v3/flat_map.hpp>
+#include <range/v3/flat_set.hpp>
 #include <range/v3/numeric.hpp>
 #include <range/v3/view.hpp>
 
@@ -0,0 +1,323 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_EYTZINGER_INDEX_HPP
+#define RANGES_V3_EYTZINGER_INDEX_HPP
+
+#include <new>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            inline void eytzinger_prefetch_(void const *p)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(p);
+#else
+                (void) p;
+#endif
+            }
+
+            inline int eytzinger_ctz_(std::size_t n)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return __builtin_ctzll(static_cast<unsigned long long>(n));
+#else
+                int i = 0;
+                for(; 0 == (n & 1); n >>= 1)
+                    ++i;
+                return i;
+#endif
+            }
+
+            // Allocates on cache line boundaries, keeping the pointer operator new
+            // returned just before the block.
+            template<typename T>
+            struct cache_line_allocator_
+            {
+                using value_type = T;
+                cache_line_allocator_() = default;
+                template<typename U>
+                cache_line_allocator_(cache_line_allocator_<U> const &)
+                {}
+                T *allocate(std::size_t n)
+                {
+                    char *const p = static_cast<char *>(::operator new(n * sizeof(T) + 64));
+                    char *const q = reinterpret_cast<char *>(
+                        (reinterpret_cast<std::uintptr_t>(p) + 64) & ~std::uintptr_t(63));
+                    reinterpret_cast<void **>(q)[-1] = p;
+                    return reinterpret_cast<T *>(q);
+                }
+                void deallocate(T *q, std::size_t)
+                {
+                    ::operator delete(reinterpret_cast<void **>(q)[-1]);
+                }
+                template<typename U>
+                bool operator==(cache_line_allocator_<U> const &) const
+                {
+                    return true;
+                }
+                template<typename U>
+                bool operator!=(cache_line_allocator_<U> const &) const
+                {
+                    return false;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// \brief A copy of a sorted range, laid out for searching.
+        ///
+        /// The elements are stored in the order a binary search visits them, the
+        /// Eytzinger layout of a complete binary tree in an array: the children of
+        /// the element at position \c k are at `2k` and `2k+1`. The first levels of
+        /// the tree share a few cache lines. The tree starts on a cache line, so when
+        /// the size of the elements divides one, the descendants of an element a few
+        /// levels down -- four for \c int -- fill a line exactly, and a search can
+        /// fetch them while it does those levels. The tree is padded to a full one with copies of the last
+        /// element, so every search takes the same number of steps, none of which
+        /// branch on the comparison.
+        ///
+        /// Positions in the sorted range are returned as indices, which \c
+        /// operator[] maps back to elements. \c lower_bounds searches for many keys
+        /// at once, a batch of them a level at a time, so the cache misses of a
+        /// batch overlap rather than happen one after another.
+        template<typename T, typename C = ordered_less>
+        struct eytzinger_index
+        {
+        private:
+            // The tree, with the element at position k in tree_[k]; tree_[0] is unused.
+            std::vector<T, detail::cache_line_allocator_<T>> tree_;
+            std::size_t size_ = 0;
+            int height_ = 0;
+            C pred_;
+
+            // How many elements a cache line holds, rounded down to a power of two.
+            static constexpr std::size_t line_elements()
+            {
+                return sizeof(T) >= 64 ? 1 : sizeof(T) >= 32 ? 2 : sizeof(T) >= 16 ? 4 :
+                    sizeof(T) >= 8 ? 8 : sizeof(T) >= 4 ? 16 : sizeof(T) >= 2 ? 32 : 64;
+            }
+            T const &at_(std::size_t k) const
+            {
+                return tree_[k];
+            }
+            void prefetch_(std::size_t k) const
+            {
+                // Not dereferenced, and can be past the end.
+                detail::eytzinger_prefetch_(reinterpret_cast<void const *>(
+                    reinterpret_cast<std::uintptr_t>(tree_.data()) +
+                        k * line_elements() * sizeof(T)));
+            }
+            // Visits the positions of the tree below k in order, filling each from
+            // the next element, or with the last one, at position last, once they
+            // run out.
+            template<typename I, typename S>
+            void fill_(std::size_t k, I &it, S const &end, std::size_t &last)
+            {
+                if(k >= tree_.size())
+                    return;
+                fill_(2 * k, it, end, last);
+                if(it != end)
+                {
+                    tree_[k] = *it;
+                    ++it;
+                    last = k;
+                }
+                else
+                    tree_[k] = tree_[last];
+                fill_(2 * k + 1, it, end, last);
+            }
+            std::size_t rank_(std::size_t k) const
+            {
+                std::size_t const r = k - (std::size_t(1) << height_);
+                return r < size_ ? r : size_;
+            }
+            // Goes down the tree from the root, left where the element is not less than
+            // val, and right where it is, or where val is not less than it if
+            // Upper; returns the position below the tree it ends up at.
+            template<bool Upper, typename V>
+            std::size_t descend_(V const &val) const
+            {
+                auto &&pred = as_function(pred_);
+                std::size_t k = 1;
+                for(int i = 0; i < height_; ++i)
+                {
+                    prefetch_(k);
+                    k = 2 * k + static_cast<std::size_t>(
+                        Upper ? !pred(val, at_(k)) : static_cast<bool>(pred(at_(k), val)));
+                }
+                return k;
+            }
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+
+            eytzinger_index() = default;
+            /// Builds the index from \c rng, which must be sorted by \c pred.
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputRange<Rng>::value &&
+                    Constructible<T, range_reference_t<Rng>>::value)>
+            explicit eytzinger_index(Rng && rng, C pred = C{})
+              : pred_(std::move(pred))
+            {
+                build_(std::forward<Rng>(rng),
+                    meta::and_<ForwardRange<Rng>, SizedRange<Rng>>());
+            }
+
+            size_type size() const
+            {
+                return size_;
+            }
+            bool empty() const
+            {
+                return 0 == size_;
+            }
+            /// The element at index \c i of the sorted range.
+            T const &operator[](size_type i) const
+            {
+                RANGES_ASSERT(i < size_);
+                std::size_t const j = i + 1;
+                int const up = detail::eytzinger_ctz_(j);
+                return at_((std::size_t(1) << (height_ - 1 - up)) + (j >> (up + 1)));
+            }
+
+            /// The index in the sorted range of the first element not less than
+            /// \c val, or \c size() if there is none.
+            template<typename V>
+            size_type lower_bound(V const &val) const
+            {
+                return rank_(descend_<false>(val));
+            }
+            /// The index in the sorted range of the first element greater than
+            /// \c val, or \c size() if there is none.
+            template<typename V>
+            size_type upper_bound(V const &val) const
+            {
+                return rank_(descend_<true>(val));
+            }
+            template<typename V>
+            std::pair<size_type, size_type> equal_range(V const &val) const
+            {
+                return {lower_bound(val), upper_bound(val)};
+            }
+            template<typename V>
+            bool binary_search(V const &val) const
+            {
+                size_type const i = lower_bound(val);
+                return i != size_ && !as_function(pred_)(val, (*this)[i]);
+            }
+
+            /// Writes the \c lower_bound of each element of \c vals to \c out, in
+            /// order, and returns the end of what was written.
+            template<typename Rng, typename O,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ForwardRange<Rng>::value &&
+                    WeakOutputIterator<O, size_type>::value)>
+            O lower_bounds(Rng && vals, O out) const
+            {
+                enum : std::size_t { batch = 16 };
+                auto &&pred = as_function(pred_);
+                I its[batch];
+                std::size_t ks[batch];
+                auto it = ranges::begin(vals);
+                auto const end = ranges::end(vals);
+                while(it != end)
+                {
+                    std::size_t m = 0;
+                    for(; m != batch && it != end; ++m, ++it)
+                    {
+                        its[m] = it;
+                        ks[m] = 1;
+                    }
+                    for(int i = 0; i < height_; ++i)
+                    {
+                        for(std::size_t j = 0; j != m; ++j)
+                        {
+                            prefetch_(ks[j]);
+                            ks[j] = 2 * ks[j] + static_cast<std::size_t>(
+                                static_cast<bool>(pred(at_(ks[j]), *its[j])));
+                        }
+                    }
+                    for(std::size_t j = 0; j != m; ++j, ++out)
+                        *out = rank_(ks[j]);
+                }
+                return out;
+            }
+        private:
+            template<typename Rng>
+            void build_(Rng && rng, std::true_type)
+            {
+                size_ = static_cast<std::size_t>(ranges::size(rng));
+                if(0 == size_)
+                    return;
+                while((std::size_t(1) << height_) - 1 < size_)
+                    ++height_;
+                auto it = ranges::begin(rng);
+                auto const end = ranges::end(rng);
+                tree_.assign(std::size_t(1) << height_, T(*it));
+                std::size_t last = 0;
+                fill_(1, it, end, last);
+            }
+            template<typename Rng>
+            void build_(Rng && rng, std::false_type)
+            {
+                build_(std::forward<Rng>(rng) | to_vector, std::true_type{});
+            }
+        };
+
+        struct make_eytzinger_index_fn
+        {
+            /// Builds an \c eytzinger_index of the elements of \c rng, which must be
+            /// sorted by \c pred.
+            template<typename Rng, typename C = ordered_less,
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+            eytzinger_index<range_value_t<Rng>, C> operator()(Rng && rng, C pred = C{}) const
+            {
+                return eytzinger_index<range_value_t<Rng>, C>{std::forward<Rng>(rng),
+                    std::move(pred)};
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `make_eytzinger_index_fn`
+        namespace
+        {
+            constexpr auto&& make_eytzinger_index = static_const<make_eytzinger_index_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
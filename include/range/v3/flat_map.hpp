@@ -0,0 +1,90 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FLAT_MAP_HPP
+#define RANGES_V3_FLAT_MAP_HPP
+
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/flat_tree.hpp>
+#include <range/v3/view/map.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// \brief A map from unique keys to values, kept sorted by key in a
+        /// \c std::vector of pairs.
+        ///
+        /// It is to \c std::map what \c flat_set is to \c std::set. The elements
+        /// are `std::pair<Key, T>`, not `std::pair<Key const, T>`, so that they can be
+        /// sorted in place; changing a key through an iterator breaks the map. They
+        /// are pairs, so \c view::keys and \c view::values work on a \c flat_map.
+        template<typename Key, typename T, typename C = std::less<Key>,
+            typename Alloc = std::allocator<std::pair<Key, T>>>
+        struct flat_map
+          : detail::flat_tree_<std::pair<Key, T>, Key, detail::get_first, C, Alloc, true>
+        {
+        private:
+            using base_t =
+                detail::flat_tree_<std::pair<Key, T>, Key, detail::get_first, C, Alloc, true>;
+            template<typename K>
+            T &subscript_(K &&key)
+            {
+                auto it = this->lower_bound(key);
+                if(it == this->end() || as_function(this->comp_)(key, it->first))
+                    it = this->data_.emplace(it, std::forward<K>(key), T());
+                return it->second;
+            }
+        public:
+            using mapped_type = T;
+            using base_t::base_t;
+
+            /// The value of \c key, which is value-initialized and inserted first if
+            /// it isn't there.
+            T &operator[](Key const &key)
+            {
+                return subscript_(key);
+            }
+            T &operator[](Key &&key)
+            {
+                return subscript_(std::move(key));
+            }
+            /// The value of \c key, which throws \c std::out_of_range if it isn't
+            /// there.
+            T &at(Key const &key)
+            {
+                auto const it = this->find(key);
+                if(it == this->end())
+                    throw std::out_of_range("ranges::flat_map::at");
+                return it->second;
+            }
+            T const &at(Key const &key) const
+            {
+                auto const it = this->find(key);
+                if(it == this->end())
+                    throw std::out_of_range("ranges::flat_map::at");
+                return it->second;
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
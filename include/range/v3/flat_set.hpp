@@ -0,0 +1,60 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FLAT_SET_HPP
+#define RANGES_V3_FLAT_SET_HPP
+
+#include <memory>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_tree.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// \brief A set of unique keys kept sorted in a \c std::vector.
+        ///
+        /// Lookups are binary searches over contiguous memory, which are much
+        /// cheaper than walking the nodes of a \c std::set; inserting or erasing
+        /// one key moves the keys after it. Inserting a range of keys appends them,
+        /// sorts them and merges them in, which takes O(m log m + n) rather than m
+        /// searches and moves. Where keys are equivalent, the first one inserted is
+        /// kept. Inserting or erasing invalidates all iterators.
+        template<typename Key, typename C = std::less<Key>, typename Alloc = std::allocator<Key>>
+        struct flat_set
+          : detail::flat_tree_<Key, Key, ident, C, Alloc, false>
+        {
+        private:
+            using base_t = detail::flat_tree_<Key, Key, ident, C, Alloc, false>;
+        public:
+            using base_t::base_t;
+        };
+
+        // The is_view heuristic takes a range whose elements are const either way
+        // for a view.
+        template<typename Key, typename C, typename Alloc>
+        struct is_view<flat_set<Key, C, Alloc>>
+          : std::false_type
+        {};
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,115 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FOR_EACH_WHILE_HPP
+#define RANGES_V3_FOR_EACH_WHILE_HPP
+
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Sink, typename Enable = void>
+            struct has_for_each_while_
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Sink>
+            struct has_for_each_while_<Rng, Sink, meta::void_<decltype(
+                range_access::for_each_while(std::declval<Rng &>(), std::declval<Sink &>()))>>
+              : std::true_type
+            {};
+
+            // Presents an element passed to a sink as something that can be
+            // dereferenced, so that iterator-based functions like indirected<F>
+            // can be applied to it.
+            template<typename T>
+            struct element_ref
+            {
+                meta::_t<std::remove_reference<T>> &t_;
+                T && operator*() const
+                {
+                    return static_cast<T &&>(t_);
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// \brief Whether a range implements internal iteration for sinks of type \c Sink,
+        /// rather than relying on the element-by-element iterator loop.
+        template<typename Rng, typename Sink>
+        using HasForEachWhile = detail::has_for_each_while_<Rng, Sink>;
+
+        /// \brief Internal iteration: pushes the elements of a range to a sink.
+        ///
+        /// A view may provide a (private) member function `for_each_while(Sink &)` that
+        /// calls the sink with each element in order, stopping early when the sink returns
+        /// `false`. Views built from other ranges implement it by passing an adapted sink to
+        /// their base, so that a whole pipeline runs as a set of ordinary nested loops
+        /// instead of through layers of cursors. Ranges without it are iterated with
+        /// `begin`/`end`.
+        struct for_each_while_fn
+        {
+        private:
+            template<typename Rng, typename Sink>
+            static auto impl_(Rng &rng, Sink &sink, int)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                range_access::for_each_while(rng, sink)
+            )
+            template<typename Rng, typename Sink,
+                typename R = decltype(std::declval<Sink &>()(*ranges::begin(std::declval<Rng &>())))>
+            static bool impl_(Rng &rng, Sink &sink, long)
+            {
+                for(auto it = ranges::begin(rng), end = ranges::end(rng); it != end; ++it)
+                    if(!sink(*it))
+                        return false;
+                return true;
+            }
+        public:
+            /// \return `false` if `sink` returned `false` for some element, `true` if all
+            /// the elements were visited.
+            template<typename Rng, typename Sink,
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+            auto operator()(Rng &&rng, Sink &&sink) const ->
+                decltype(for_each_while_fn::impl_(rng, sink, 42))
+            {
+                return for_each_while_fn::impl_(rng, sink, 42);
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `for_each_while_fn`
+        namespace
+        {
+            constexpr auto&& for_each_while = static_const<for_each_while_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -15,8 +15,15 @@
 #define RANGES_V3_GETLINES_HPP
 
 #include <string>
+#include <vector>
+#include <cstring>
 #include <istream>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -24,6 +31,58 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Contiguous containers of chars like std::string and std::vector<char>,
+            // and ranges of pointers to char.
+            template<typename Rng,
+                typename P = decltype(std::declval<Rng &>().data()),
+                CONCEPT_REQUIRES_(ConvertibleTo<P, char const *>::value && SizedRange<Rng>::value)>
+            range<char const *> char_buffer_(Rng &rng, int)
+            {
+                char const *data = rng.data();
+                return {data, data + ranges::size(rng)};
+            }
+            template<typename Rng,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ConvertibleTo<I, char const *>::value &&
+                    Same<I, range_sentinel_t<Rng>>::value)>
+            range<char const *> char_buffer_(Rng &rng, long)
+            {
+                return {ranges::begin(rng), ranges::end(rng)};
+            }
+
+            // Cuts a buffer into at most n pieces of about the same size, or one if n
+            // is 0. Each cut is moved forward to just after the next delimiter, so
+            // that no piece starts or ends in the middle of a token.
+            template<typename IsDelim>
+            std::vector<range<char const *>> partition_buffer_(char const *first,
+                char const *last, std::size_t n, IsDelim is_delim)
+            {
+                if(0 == n)
+                    n = 1;
+                std::vector<range<char const *>> parts;
+                parts.reserve(n);
+                std::size_t const size = static_cast<std::size_t>(last - first);
+                char const *begin = first;
+                for(std::size_t i = 1; i <= n && begin != last; ++i)
+                {
+                    char const *cut = i == n ? last : first + size / n * i;
+                    if(cut < begin)
+                        cut = begin;
+                    while(cut != last && !is_delim(*cut))
+                        ++cut;
+                    if(cut != last)
+                        ++cut;
+                    parts.push_back({begin, cut});
+                    begin = cut;
+                }
+                return parts;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-core
         /// @{
         struct getlines_range
@@ -77,12 +136,89 @@ namespace ranges
             }
         };
 
+        /// \brief The lines of a character buffer that is already in memory, as
+        /// subranges of the buffer.
+        ///
+        /// Nothing is copied: each line is a `range<char const *>` into the buffer,
+        /// found with `memchr`. As with \c std::getline, the delimiter is not part
+        /// of the line and a final delimiter doesn't start an empty line. When the
+        /// delimiter is `'\n'`, a `'\r'` before it is dropped too, so files with
+        /// CRLF line endings read the same as ones without.
+        struct buffer_lines_range
+          : view_facade<buffer_lines_range, finite>
+        {
+        private:
+            friend range_access;
+            char const *begin_, *end_;
+            char delim_;
+            struct cursor
+            {
+            private:
+                char const *first_, *last_, *next_, *end_;
+                char delim_;
+                void satisfy()
+                {
+                    if(first_ == end_)
+                        return;
+                    auto p = static_cast<char const *>(
+                        std::memchr(first_, delim_, static_cast<std::size_t>(end_ - first_)));
+                    last_ = p ? p : end_;
+                    next_ = p ? p + 1 : end_;
+                    if('\n' == delim_ && last_ != first_ && '\r' == last_[-1])
+                        --last_;
+                }
+            public:
+                cursor() = default;
+                cursor(char const *first, char const *last, char delim)
+                  : first_(first), last_(first), next_(first), end_(last), delim_(delim)
+                {
+                    satisfy();
+                }
+                range<char const *> current() const
+                {
+                    return {first_, last_};
+                }
+                void next()
+                {
+                    first_ = next_;
+                    satisfy();
+                }
+                bool equal(cursor const &that) const
+                {
+                    return first_ == that.first_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {begin_, end_, delim_};
+            }
+            cursor end_cursor() const
+            {
+                return {end_, end_, delim_};
+            }
+        public:
+            buffer_lines_range() = default;
+            buffer_lines_range(char const *first, char const *last, char delim = '\n')
+              : begin_(first), end_(last), delim_(delim)
+            {}
+        };
+
         struct getlines_fn
         {
             getlines_range operator()(std::istream & sin, char delim = '\n') const
             {
                 return getlines_range{sin, delim};
             }
+            /// \overload
+            /// Reads the lines of a contiguous buffer of chars without copying them.
+            /// The lines point into the buffer, so it must outlive them.
+            template<typename Rng,
+                typename B = decltype(detail::char_buffer_(std::declval<Rng &>(), 42))>
+            buffer_lines_range operator()(Rng & rng, char delim = '\n') const
+            {
+                B buf = detail::char_buffer_(rng, 42);
+                return {buf.begin(), buf.end(), delim};
+            }
         };
 
         namespace
@@ -15,6 +15,7 @@
 
 #include <meta/meta.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -36,6 +37,25 @@ namespace ranges
             Callable<Op, T, X>,
             Assignable<T&, Y>>;
 
+        /// \cond
+        namespace detail
+        {
+            template<typename T, typename Op, typename P>
+            struct accumulate_sink
+            {
+                T &acc_;
+                Op &op_;
+                P &proj_;
+                template<typename U>
+                bool operator()(U &&u) const
+                {
+                    acc_ = op_(acc_, proj_(static_cast<U &&>(u)));
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
         struct accumulate_fn
         {
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
@@ -60,10 +80,14 @@ namespace ranges
 #else
                 CONCEPT_REQUIRES_(Range<Rng>() && Accumulateable<I, T, Op, P>())>
 #endif
-            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            T operator()(Rng && rng, T init, Op op_ = Op{}, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
-                    std::move(proj));
+                auto &&op = as_function(op_);
+                auto &&proj = as_function(proj_);
+                ranges::for_each_while(rng,
+                    detail::accumulate_sink<T, uncvref_t<decltype(op)>, uncvref_t<decltype(proj)>>{
+                        init, op, proj});
+                return init;
             }
         };
 
@@ -0,0 +1,251 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_GROUP_AGGREGATE_HPP
+#define RANGES_V3_NUMERIC_GROUP_AGGREGATE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/for_each_while.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_set.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename Key, typename T, typename Op = plus, typename P = ident,
+            typename K = iterator_value_t<Project<I, Key>>>
+        using GroupAggregateable = meta::fast_and<
+            Accumulateable<I, T, Op, P>,
+            Projectable<I, Key>,
+            EqualityComparable<K>,
+            CopyConstructible<K>,
+            CopyConstructible<T>>;
+
+        /// \cond
+        namespace detail
+        {
+            // The groups of a range, or of a slice of one: the key and accumulator of
+            // each, in the order their keys were first seen, and the keys' indices.
+            template<typename K, typename T>
+            struct group_table_
+            {
+                hash_index_<K, default_hash_> index_;
+                std::vector<std::pair<K, T>> groups_;
+
+                template<typename KeyRef>
+                T &find(KeyRef &&key, T const &init)
+                {
+                    auto const res = index_.insert(key, groups_.size());
+                    if(res.second)
+                        groups_.emplace_back(static_cast<KeyRef &&>(key), init);
+                    return groups_[res.first].second;
+                }
+            };
+
+            template<typename K, typename T, typename Key, typename Op, typename P>
+            struct group_aggregate_sink
+            {
+                group_table_<K, T> &table_;
+                T const &init_;
+                Key &key_;
+                Op &op_;
+                P &proj_;
+                template<typename U>
+                bool operator()(U &&u) const
+                {
+                    T &acc = table_.find(key_(u), init_);
+                    acc = op_(std::move(acc), proj_(static_cast<U &&>(u)));
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-numerics
+        /// @{
+
+        /// \brief Aggregates the elements of a range by key, without sorting it first.
+        ///
+        /// Each element goes to the group of its key, `key(elem)`, which starts from
+        /// \c init, and is added to it the way \c accumulate adds elements, with
+        /// `acc = op(std::move(acc), proj(elem))`. Returns a `std::vector` of pairs of a
+        /// key and its accumulator, in the order the keys first appear in the range.
+        /// Keys are looked up in a hash table, with `std::hash` and `==`; integers,
+        /// enumerations and pointers go in a flat open-addressing table.
+        ///
+        /// Given \c par or a \c parallel_t, a sized random-access range is split into
+        /// slices, one per thread, each of which builds its own table. The groups of
+        /// the first slice start from \c init, and those of the others from \c identity.
+        /// The tables are then merged on the calling thread, in order, combining the
+        /// accumulators of the same key with `merge(std::move(acc), std::move(other))`,
+        /// which defaults to \c op; a group first seen in a later slice is merged into
+        /// \c init. The result is as if the range were aggregated in one pass, so long
+        /// as \c merge combines accumulators the way \c op would and \c identity is
+        /// an identity for it. Without an \c identity, \c init is used, so it must be
+        /// one itself, like 0 for \c plus. Any other range, or one too small to split,
+        /// is aggregated on the calling thread.
+        struct group_aggregate_fn
+        {
+        private:
+            // No thread gets fewer elements than this.
+            enum : std::size_t { grain_ = 1u << 14 };
+
+            template<typename K, typename T, typename I, typename Key, typename Op, typename P>
+            static void aggregate_(detail::group_table_<K, T> &table, I first, std::size_t n,
+                T const &init, Key &key, Op &op, P &proj)
+            {
+                for(; n != 0; --n, ++first)
+                {
+                    T &acc = table.find(key(*first), init);
+                    acc = op(std::move(acc), proj(*first));
+                }
+            }
+        public:
+            template<typename Rng, typename Key, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename K = iterator_value_t<Project<I, Key>>,
+                CONCEPT_REQUIRES_(Range<Rng>::value && GroupAggregateable<I, Key, T, Op, P>::value)>
+            std::vector<std::pair<K, T>>
+            operator()(Rng && rng, Key key_, T init, Op op_ = Op{}, P proj_ = P{}) const
+            {
+                auto &&key = as_function(key_);
+                auto &&op = as_function(op_);
+                auto &&proj = as_function(proj_);
+                detail::group_table_<K, T> table;
+                ranges::for_each_while(rng,
+                    detail::group_aggregate_sink<K, T, uncvref_t<decltype(key)>,
+                        uncvref_t<decltype(op)>, uncvref_t<decltype(proj)>>{
+                            table, init, key, op, proj});
+                return std::move(table.groups_);
+            }
+
+            /// \overload
+            template<typename Rng, typename Key, typename T, typename Op, typename P, typename M,
+                typename I = range_iterator_t<Rng>,
+                typename K = iterator_value_t<Project<I, Key>>,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && SizedRange<Rng>::value &&
+                    GroupAggregateable<I, Key, T, Op, P>::value &&
+                    Callable<M, T, T>::value)>
+            std::vector<std::pair<K, T>>
+            operator()(parallel_t policy, Rng && rng, Key key_, T init, Op op_, P proj_,
+                M merge_, T identity) const
+            {
+                std::size_t const n = static_cast<std::size_t>(ranges::size(rng));
+                std::size_t const k = detail::slice_count_(n, policy, grain_);
+                if(k < 2)
+                    return (*this)(std::forward<Rng>(rng), std::move(key_), std::move(init),
+                        std::move(op_), std::move(proj_));
+
+                auto &&merge = as_function(merge_);
+                auto const first = ranges::begin(rng);
+                std::vector<detail::group_table_<K, T>> tables(k);
+                detail::run_slices_(k, [&](std::size_t i)
+                {
+                    // Each thread has its own copies of the function objects.
+                    auto key = as_function(key_);
+                    auto op = as_function(op_);
+                    auto proj = as_function(proj_);
+                    auto const bounds = detail::slice_bounds_(n, k, i);
+                    group_aggregate_fn::aggregate_(tables[i],
+                        first + static_cast<range_difference_t<Rng>>(bounds.first),
+                        bounds.second - bounds.first, 0 == i ? init : identity, key, op, proj);
+                });
+
+                detail::group_table_<K, T> &table = tables[0];
+                for(std::size_t i = 1; i != k; ++i)
+                {
+                    for(auto &group : tables[i].groups_)
+                    {
+                        auto const res = table.index_.insert(group.first, table.groups_.size());
+                        if(res.second)
+                        {
+                            group.second = merge(T(init), std::move(group.second));
+                            table.groups_.push_back(std::move(group));
+                        }
+                        else
+                        {
+                            T &acc = table.groups_[res.first].second;
+                            acc = merge(std::move(acc), std::move(group.second));
+                        }
+                    }
+                    tables[i] = detail::group_table_<K, T>{};
+                }
+                return std::move(table.groups_);
+            }
+
+            /// \overload
+            template<typename Rng, typename Key, typename T, typename Op, typename P, typename M,
+                typename I = range_iterator_t<Rng>,
+                typename K = iterator_value_t<Project<I, Key>>,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && SizedRange<Rng>::value &&
+                    GroupAggregateable<I, Key, T, Op, P>::value &&
+                    Callable<M, T, T>::value)>
+            std::vector<std::pair<K, T>>
+            operator()(parallel_t policy, Rng && rng, Key key, T init, Op op, P proj,
+                M merge) const
+            {
+                T identity = init;
+                return (*this)(policy, std::forward<Rng>(rng), std::move(key), std::move(init),
+                    std::move(op), std::move(proj), std::move(merge), std::move(identity));
+            }
+
+            /// \overload
+            template<typename Rng, typename Key, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Range<Rng>::value && GroupAggregateable<I, Key, T, Op, P>::value)>
+            auto operator()(parallel_t policy, Rng && rng, Key key, T init, Op op = Op{},
+                P proj = P{}) const ->
+                decltype(std::declval<group_aggregate_fn const &>()(policy,
+                    std::forward<Rng>(rng), std::move(key), std::move(init), op, std::move(proj), op))
+            {
+                return (*this)(policy, std::forward<Rng>(rng), std::move(key), std::move(init),
+                    op, std::move(proj), op);
+            }
+
+            /// \overload
+            template<typename Rng, typename Key, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename K = iterator_value_t<Project<I, Key>>,
+                CONCEPT_REQUIRES_(Range<Rng>::value && GroupAggregateable<I, Key, T, Op, P>::value &&
+                    !(RandomAccessRange<Rng>::value && SizedRange<Rng>::value))>
+            std::vector<std::pair<K, T>>
+            operator()(parallel_t, Rng && rng, Key key, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(std::forward<Rng>(rng), std::move(key), std::move(init),
+                    std::move(op), std::move(proj));
+            }
+        };
+
+        /// \sa `group_aggregate_fn`
+        /// \ingroup group-numerics
+        namespace
+        {
+            constexpr auto&& group_aggregate = static_const<group_aggregate_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -181,6 +181,13 @@ namespace ranges
                 pos0.distance_to(pos1)
             )
 
+            template<typename Rng, typename Sink>
+            static auto for_each_while(Rng & rng, Sink & sink)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                rng.for_each_while(sink)
+            )
+
         private:
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_ALIAS_DECLTYPE
             template <typename T>
@@ -271,6 +271,17 @@ namespace ranges
             {};
 #endif
 
+#if !defined(__GLIBCXX__) || defined(_GLIBCXX_RELEASE)
+            template<typename T>
+            using is_trivially_copyable = std::is_trivially_copyable<T>;
+#else
+            // libstdc++ before GCC 5 lacks std::is_trivially_copyable.
+            template<typename T>
+            struct is_trivially_copyable
+              : meta::bool_<__has_trivial_copy(T) && std::is_trivially_destructible<T>::value>
+            {};
+#endif
+
             template<typename T>
             struct remove_rvalue_reference
             {
@@ -447,6 +458,32 @@ namespace ranges
             struct cycle_fn;
         }
 
+        template<typename Rng, typename P, typename H>
+        struct distinct_view;
+
+        namespace view
+        {
+            struct distinct_fn;
+        }
+
+        struct left_outer_t;
+
+        template<typename Build, typename Probe, typename BK, typename PK, bool Outer>
+        struct hash_join_view;
+
+        namespace view
+        {
+            struct hash_join_fn;
+        }
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        struct merge_join_view;
+
+        namespace view
+        {
+            struct merge_join_fn;
+        }
+
         namespace detail
         {
             template<typename I> struct reverse_cursor;
@@ -516,6 +553,13 @@ namespace ranges
             struct concat_fn;
         }
 
+        struct partition_lines_view;
+
+        namespace view
+        {
+            struct partition_lines_fn;
+        }
+
         template<typename Rng, typename Fun>
         struct partial_sum_view;
 
@@ -524,6 +568,14 @@ namespace ranges
             struct partial_sum_fn;
         }
 
+        template<typename Rng>
+        struct prepared_view;
+
+        namespace view
+        {
+            struct prepare_fn;
+        }
+
         template<typename Rng>
         struct move_view;
 
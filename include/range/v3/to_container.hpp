@@ -14,10 +14,18 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <memory>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/for_each_while.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/action/concepts.hpp>
 
@@ -35,6 +43,35 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \addtogroup group-core
+        /// @{
+
+        /// \brief How many elements \c to_vector and \c to_ should make room for up
+        /// front, when the range can't say: `to_vector(rng, size_hint(n))`, or
+        /// `rng | to_vector(size_hint(n))`. The container still grows if the hint is
+        /// too small. Ignored for a sized range, or a container that can't reserve.
+        struct size_hint
+        {
+            std::size_t n;
+            explicit constexpr size_hint(std::size_t n_)
+              : n(n_)
+            {}
+        };
+
+        /// \brief Tells \c to_vector and \c to_ to count the elements of a forward
+        /// range that doesn't know its size before copying them, so the container
+        /// allocates once: `rng | to_vector(count_first)`. It is an extra pass over the
+        /// range, which pays when the elements are expensive to move or there are
+        /// many of them, and not when each one is expensive to compute.
+        struct count_first_t
+        {};
+
+        namespace
+        {
+            constexpr auto&& count_first = static_const<count_first_t>::value;
+        }
+        /// @}
+
         /// \cond
         namespace detail
         {
@@ -46,17 +83,124 @@ namespace ranges
                 ConvertibleTo<range_value_t<Rng>, range_value_t<Cont>>,
                 Constructible<Cont, I, I>>;
 
+            template<typename Cont>
+            struct push_back_sink
+            {
+                Cont &cont_;
+                template<typename T, typename C = Cont>
+                auto operator()(T &&t) const ->
+                    decltype(std::declval<C &>().push_back(static_cast<T &&>(t)), bool())
+                {
+                    cont_.push_back(static_cast<T &&>(t));
+                    return true;
+                }
+            };
+
+            // The tags that to_vector and friends take after the range.
+            template<typename Hint>
+            using ToContainerHint = meta::or_<
+                Same<Hint, size_hint>,
+                Same<Hint, count_first_t>,
+                Same<Hint, parallel_t>>;
+
+            template<typename A, typename = void>
+            struct Allocator
+              : std::false_type
+            {};
+            template<typename A>
+            struct Allocator<A, meta::void_<typename A::value_type,
+                decltype(std::declval<A &>().allocate(std::size_t{}))>>
+              : std::true_type
+            {};
+
+            template<typename C, typename = void>
+            struct resizable_
+              : std::false_type
+            {};
+            template<typename C>
+            struct resizable_<C, meta::void_<
+                decltype(std::declval<C &>().resize(std::declval<C &>().size()))>>
+              : std::true_type
+            {};
+
             template<typename ContainerMetafunctionClass>
             struct to_container_fn
               : pipeable<to_container_fn<ContainerMetafunctionClass>>
             {
             private:
+                // Elements of the container that can be assigned from different
+                // threads without a race, unlike the bits of a vector<bool>.
+                template <typename C, typename R>
+                using ParallelConcept =
+                    meta::fast_and<
+                        RandomAccessRange<R>,
+                        SizedRange<R>,
+                        DefaultConstructible<C>,
+                        resizable_<C>,
+                        RandomAccessRange<C>,
+                        std::is_lvalue_reference<range_reference_t<C>>,
+                        Writable<range_iterator_t<C>, range_reference_t<R>>>;
+
+                // No thread gets fewer elements than this.
+                static constexpr std::size_t parallel_grain_ = 1u << 12;
                 template <typename C, typename R>
                 using ReserveConcept =
                     meta::fast_and<
                         ReserveAndAssignable<C, range_common_iterator_t<R>>,
                         SizedRange<R>>;
 
+                // Ranges that implement internal iteration are appended element by
+                // element as they push them.
+                template <typename C, typename R>
+                using PushBackConcept =
+                    meta::fast_and<
+                        DefaultConstructible<C>,
+                        HasForEachWhile<R, push_back_sink<C>>>;
+
+                struct push_back_tag
+                {};
+
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &c, Rng &rng, std::true_type)
+                {
+                    c.reserve(size(rng));
+                }
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &, Rng &, std::false_type)
+                {}
+
+                // A container that can reserve, and be filled after it has, from a
+                // range that can't say how big it is.
+                template <typename C, typename R>
+                using HintConcept =
+                    meta::fast_and<
+                        Reservable<C>,
+                        meta::not_<SizedRange<R>>,
+                        meta::fast_or<
+                            PushBackConcept<C, R>,
+                            ReserveAndAssignable<C, range_common_iterator_t<R>>>>;
+
+                template<typename Cont, typename Rng>
+                static void fill_(Cont &c, Rng &rng, std::true_type)
+                {
+                    ranges::for_each_while(rng, push_back_sink<Cont>{c});
+                }
+                template<typename Cont, typename Rng>
+                static void fill_(Cont &c, Rng &rng, std::false_type)
+                {
+                    using I = range_common_iterator_t<Rng>;
+                    c.assign(I{begin(rng)}, I{end(rng)});
+                }
+
+                template<typename Cont, typename Rng>
+                static Cont reserve_and_fill_(Rng &rng, std::size_t n)
+                {
+                    Cont c;
+                    c.reserve(n);
+                    to_container_fn::fill_(c, rng, PushBackConcept<Cont, Rng>());
+                    return c;
+                }
+
                 template<typename Rng,
                     typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -88,6 +232,23 @@ namespace ranges
                     return c;
                 }
 
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Range<Rng>::value && detail::ConvertibleToContainer<Rng, Cont>::value &&
+                                      PushBackConcept<Cont, Rng>::value)>
+#else
+                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>() &&
+                                      PushBackConcept<Cont, Rng>())>
+#endif
+                Cont impl(Rng && rng, push_back_tag) const
+                {
+                    Cont c;
+                    to_container_fn::reserve_(c, rng, ReserveConcept<Cont, Rng>());
+                    ranges::for_each_while(rng, push_back_sink<Cont>{c});
+                    return c;
+                }
+
             public:
                 template<typename Rng,
                     typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
@@ -100,7 +261,226 @@ namespace ranges
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                    return impl(std::forward<Rng>(rng),
+                        meta::if_<PushBackConcept<Cont, Rng>, push_back_tag,
+                            ReserveConcept<Cont, Rng>>());
+                }
+
+                /// \overload
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>::value && detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        HintConcept<Cont, Rng>::value)>
+                Cont operator()(Rng && rng, size_hint hint) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to convert an infinite range to a container.");
+                    return to_container_fn::reserve_and_fill_<Cont>(rng, hint.n);
+                }
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>::value && detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        !HintConcept<Cont, Rng>::value)>
+                Cont operator()(Rng && rng, size_hint) const
+                {
+                    return (*this)(std::forward<Rng>(rng));
+                }
+
+                /// \overload
+                /// Only a range whose elements are pushed one at a time is counted; a
+                /// container constructed from forward iterators counts them itself.
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(ForwardRange<Rng>::value &&
+                        detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        HintConcept<Cont, Rng>::value && PushBackConcept<Cont, Rng>::value)>
+                Cont operator()(Rng && rng, count_first_t) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to convert an infinite range to a container.");
+                    return to_container_fn::reserve_and_fill_<Cont>(rng,
+                        static_cast<std::size_t>(distance(rng)));
+                }
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(ForwardRange<Rng>::value &&
+                        detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        !(HintConcept<Cont, Rng>::value && PushBackConcept<Cont, Rng>::value))>
+                Cont operator()(Rng && rng, count_first_t) const
+                {
+                    return (*this)(std::forward<Rng>(rng));
+                }
+
+                /// \overload
+                /// Splits a sized random-access range among threads, into a random-access
+                /// container that is resized, then filled a slice per thread.
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>::value && detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        ParallelConcept<Cont, Rng>::value)>
+                Cont operator()(Rng && rng, parallel_t policy) const
+                {
+                    using D = range_difference_t<Rng>;
+                    std::size_t const n = static_cast<std::size_t>(size(rng));
+                    std::size_t const k = detail::slice_count_(n, policy, parallel_grain_);
+                    if(k < 2)
+                        return (*this)(std::forward<Rng>(rng));
+
+                    Cont c;
+                    c.resize(n);
+                    auto const first = begin(rng);
+                    auto const out = begin(c);
+                    detail::run_slices_(k, [&](std::size_t i)
+                    {
+                        auto const bounds = detail::slice_bounds_(n, k, i);
+                        auto it = first + static_cast<D>(bounds.first);
+                        auto o = out + static_cast<range_difference_t<Cont>>(bounds.first);
+                        for(std::size_t j = bounds.first; j != bounds.second; ++j, ++it, ++o)
+                            *o = *it;
+                    });
+                    return c;
+                }
+                template<typename Rng,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>::value && detail::ConvertibleToContainer<Rng, Cont>::value &&
+                        !ParallelConcept<Cont, Rng>::value)>
+                Cont operator()(Rng && rng, parallel_t) const
+                {
+                    return (*this)(std::forward<Rng>(rng));
+                }
+
+                /// \overload
+                template<typename Hint,
+                    CONCEPT_REQUIRES_(ToContainerHint<Hint>::value)>
+                auto operator()(Hint hint) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(*this, std::placeholders::_1, hint))
+                )
+            };
+
+            struct assign_to_fn
+            {
+            private:
+                template<typename C, typename = void>
+                struct clearable_
+                  : std::false_type
+                {};
+                template<typename C>
+                struct clearable_<C, meta::void_<decltype(std::declval<C &>().clear())>>
+                  : std::true_type
+                {};
+                // Reservable and Container want a default-constructible container,
+                // which one with a stateful allocator isn't.
+                template<typename C, typename = void>
+                struct reservable_
+                  : std::false_type
+                {};
+                template<typename C>
+                struct reservable_<C, meta::void_<
+                    decltype(std::declval<C &>().reserve(std::declval<C &>().size()))>>
+                  : std::true_type
+                {};
+                template<typename C, typename I, typename = void>
+                struct assignable_
+                  : std::false_type
+                {};
+                template<typename C, typename I>
+                struct assignable_<C, I, meta::void_<
+                    decltype(std::declval<C &>().assign(std::declval<I>(), std::declval<I>()))>>
+                  : std::true_type
+                {};
+
+                struct push_back_tag {};
+                struct assign_tag {};
+                struct construct_tag {};
+
+                template<typename Cont, typename Rng, typename I = range_common_iterator_t<Rng>>
+                using fill_tag_ =
+                    meta::if_<
+                        meta::and_<clearable_<Cont>, HasForEachWhile<Rng, push_back_sink<Cont>>>,
+                        push_back_tag,
+                        meta::if_<assignable_<Cont, I>, assign_tag, construct_tag>>;
+
+                // Empty the container before reserving, so nothing is copied if it
+                // has to grow.
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &c, Rng &rng, std::true_type)
+                {
+                    c.clear();
+                    c.reserve(size(rng));
+                }
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &, Rng &, std::false_type)
+                {}
+
+                template<typename Cont, typename Rng>
+                static void fill_(Cont &c, Rng &rng, push_back_tag)
+                {
+                    c.clear();
+                    ranges::for_each_while(rng, push_back_sink<Cont>{c});
+                }
+                template<typename Cont, typename Rng>
+                static void fill_(Cont &c, Rng &rng, assign_tag)
+                {
+                    using I = range_common_iterator_t<Rng>;
+                    c.assign(I{begin(rng)}, I{end(rng)});
+                }
+                template<typename Cont, typename Rng>
+                static void fill_(Cont &c, Rng &rng, construct_tag)
+                {
+                    using I = range_common_iterator_t<Rng>;
+                    c = Cont(I{begin(rng)}, I{end(rng)});
+                }
+            public:
+                // Only a container that is replaced, rather than refilled, needs to be
+                // constructible from the range's iterators.
+                template<typename Rng, typename Cont>
+                using Concept = meta::and_<
+                    Range<Rng>,
+                    Range<Cont>,
+                    meta::not_<View<Cont>>,
+                    ConvertibleTo<range_value_t<Rng>, range_value_t<Cont>>,
+                    meta::or_<
+                        meta::not_<std::is_same<fill_tag_<Cont, Rng>, construct_tag>>,
+                        ConvertibleToContainer<Rng, Cont>>>;
+
+                template<typename Rng, typename Cont,
+                    CONCEPT_REQUIRES_(Concept<Rng, Cont>::value)>
+                Cont &operator()(Rng && rng, Cont &cont) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to convert an infinite range to a container.");
+                    assign_to_fn::reserve_(cont, rng,
+                        meta::and_<clearable_<Cont>, reservable_<Cont>, SizedRange<Rng>>());
+                    assign_to_fn::fill_(cont, rng, fill_tag_<Cont, Rng>());
+                    return cont;
+                }
+            };
+
+            template<typename ContainerMetafunctionClass, typename Alloc>
+            struct to_container_alloc_fn
+              : pipeable<to_container_alloc_fn<ContainerMetafunctionClass, Alloc>>
+            {
+            private:
+                template<typename T>
+                using alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+                Alloc alloc_;
+            public:
+                to_container_alloc_fn() = default;
+                explicit to_container_alloc_fn(Alloc alloc)
+                  : alloc_(std::move(alloc))
+                {}
+                template<typename Rng, typename T = range_value_t<Rng>,
+                    typename Cont = meta::apply<ContainerMetafunctionClass, T, alloc_t<T>>,
+                    CONCEPT_REQUIRES_(Constructible<Cont, alloc_t<T>>::value &&
+                        assign_to_fn::Concept<Rng, Cont>::value)>
+                Cont operator()(Rng && rng) const
+                {
+                    alloc_t<T> alloc(alloc_);
+                    Cont c(alloc);
+                    assign_to_fn{}(rng, c);
+                    return c;
                 }
             };
         }
@@ -109,6 +489,16 @@ namespace ranges
         /// \addtogroup group-core
         /// @{
 
+        /// \ingroup group-core
+        /// Empties \c cont and fills it with the elements of \c rng, keeping the
+        /// memory \c cont already has where the container allows it. A \c std::vector
+        /// filled from ranges of similar sizes over and over stops allocating once it
+        /// is big enough. Returns \c cont.
+        namespace
+        {
+            constexpr auto&& assign_to = static_const<detail::assign_to_fn>::value;
+        }
+
         /// \ingroup group-core
         namespace
         {
@@ -155,6 +545,45 @@ namespace ranges
             return {};
         }
 
+        /// \overload
+        /// A container of the specified kind that allocates with \c alloc, rebound
+        /// to the range's value type: `rng | to_<std::vector>(arena_allocator<int>{arena})`.
+        template<template<typename...> class ContT, typename Alloc,
+            CONCEPT_REQUIRES_(!Range<Alloc>::value && detail::Allocator<Alloc>::value)>
+        detail::to_container_alloc_fn<meta::quote<ContT>, Alloc> to_(Alloc alloc)
+        {
+            return detail::to_container_alloc_fn<meta::quote<ContT>, Alloc>{std::move(alloc)};
+        }
+
+        /// \overload
+        /// The hints of \c to_vector, for any kind of container: `rng | to_<std::deque>(par)`.
+        template<template<typename...> class ContT, typename Hint,
+            CONCEPT_REQUIRES_(detail::ToContainerHint<Hint>::value)>
+        auto to_(Hint hint)
+        RANGES_DECLTYPE_AUTO_RETURN
+        (
+            ranges::to_<ContT>()(hint)
+        )
+
+        /// \overload
+        template<template<typename...> class ContT, typename Alloc>
+        detail::to_container_alloc_fn<meta::quote<ContT>, Alloc> to_()
+        {
+            return {};
+        }
+
+        /// \overload
+        /// Fills an existing container, with \c assign_to: `rng | to_(cont)`.
+        /// The leading pack keeps `to_<Cont>(rng)` from selecting this overload.
+        template<int...NoExplicitArgs, typename Cont,
+            CONCEPT_REQUIRES_(sizeof...(NoExplicitArgs) == 0 && Range<Cont>::value &&
+                !View<Cont>::value)>
+        auto to_(Cont &cont)
+        RANGES_DECLTYPE_AUTO_RETURN
+        (
+            make_pipeable(std::bind(assign_to, std::placeholders::_1, std::ref(cont)))
+        )
+
         /// \overload
         template<typename Cont, typename Rng,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
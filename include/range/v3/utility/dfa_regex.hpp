@@ -0,0 +1,711 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_DFA_REGEX_HPP
+#define RANGES_V3_UTILITY_DFA_REGEX_HPP
+
+#include <map>
+#include <algorithm>
+#include <regex>
+#include <bitset>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// \brief A regular expression compiled once into a deterministic finite
+        /// automaton over bytes.
+        ///
+        /// Only the part of the ECMAScript grammar that can be matched without
+        /// backtracking is supported: literal characters, `.`, the escapes `\d \w \s
+        /// \D \W \S \n \t \r \f \v \0` and escaped metacharacters, bracket expressions
+        /// with ranges and negation, groups (which do not capture), alternation, and the
+        /// quantifiers `*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`. Anything else, as well
+        /// as a pattern whose automaton would grow beyond `max_states` states, throws
+        /// `std::regex_error`.
+        ///
+        /// Matches are leftmost-longest, as with POSIX regular expressions, and empty
+        /// matches are never reported. Matching costs one table lookup per character
+        /// and never allocates. Copies share the compiled automaton, which is immutable.
+        struct dfa_regex
+        {
+        private:
+            using charset = std::bitset<256>;
+
+            struct automaton
+            {
+                // Row s holds the transitions out of state s. State 0 is the dead
+                // state, state 1 is the start state.
+                std::vector<int> table_;
+                std::vector<char> accept_;
+                // The same for the automaton search runs, which matches from every
+                // position at once. It is empty if that automaton would be too big.
+                // Each transition also has a move, an offset into moves_, that says
+                // how the start positions the search keeps change; see
+                // compile_search. On entering state s, the best match so far ends
+                // at the position and starts at the start with index found_[s],
+                // unless that is -1.
+                std::vector<int> search_table_, search_moves_;
+                std::vector<signed char> moves_, found_;
+                // The most start positions it keeps at once.
+                int slots_ = 0;
+            };
+
+            struct compiler
+            {
+            private:
+                enum kind_t { empty_k, set_k, cat_k, alt_k, repeat_k };
+                struct node
+                {
+                    kind_t kind;
+                    charset set;
+                    int lhs, rhs;
+                    int min, max; // max == -1 is unbounded
+                };
+                struct nfa_state
+                {
+                    charset set;
+                    int next;
+                    int eps[2];
+                };
+                struct fragment
+                {
+                    int start, end;
+                };
+
+                char const *cur_, *end_;
+                std::vector<node> nodes_;
+                std::vector<nfa_state> nfa_;
+
+                [[noreturn]] static void fail(std::regex_constants::error_type err)
+                {
+                    throw std::regex_error(err);
+                }
+                int add(kind_t kind, int lhs = -1, int rhs = -1)
+                {
+                    nodes_.push_back(node{kind, charset{}, lhs, rhs, 0, 0});
+                    return static_cast<int>(nodes_.size()) - 1;
+                }
+                int add(charset const &set)
+                {
+                    int n = add(set_k);
+                    nodes_[static_cast<std::size_t>(n)].set = set;
+                    return n;
+                }
+                static int single(charset const &set)
+                {
+                    if(set.count() != 1)
+                        return -1;
+                    int i = 0;
+                    while(!set[static_cast<std::size_t>(i)])
+                        ++i;
+                    return i;
+                }
+                static charset range_of(int lo, int hi)
+                {
+                    charset set;
+                    for(; lo <= hi; ++lo)
+                        set.set(static_cast<std::size_t>(lo));
+                    return set;
+                }
+                static charset one(char c)
+                {
+                    charset set;
+                    set.set(static_cast<unsigned char>(c));
+                    return set;
+                }
+                static charset of(char const *chars)
+                {
+                    charset set;
+                    for(; *chars; ++chars)
+                        set.set(static_cast<unsigned char>(*chars));
+                    return set;
+                }
+
+                // Parsing
+                int parse_alt()
+                {
+                    int lhs = parse_cat();
+                    while(cur_ != end_ && *cur_ == '|')
+                    {
+                        ++cur_;
+                        int rhs = parse_cat();
+                        lhs = add(alt_k, lhs, rhs);
+                    }
+                    return lhs;
+                }
+                int parse_cat()
+                {
+                    int lhs = -1;
+                    while(cur_ != end_ && *cur_ != '|' && *cur_ != ')')
+                    {
+                        int rhs = parse_repeat();
+                        lhs = -1 == lhs ? rhs : add(cat_k, lhs, rhs);
+                    }
+                    return -1 == lhs ? add(empty_k) : lhs;
+                }
+                int parse_int()
+                {
+                    if(cur_ == end_ || *cur_ < '0' || *cur_ > '9')
+                        fail(std::regex_constants::error_badbrace);
+                    int i = 0;
+                    for(; cur_ != end_ && *cur_ >= '0' && *cur_ <= '9'; ++cur_)
+                        if((i = i * 10 + (*cur_ - '0')) > 1000)
+                            fail(std::regex_constants::error_complexity);
+                    return i;
+                }
+                int parse_repeat()
+                {
+                    int atom = parse_atom();
+                    while(cur_ != end_)
+                    {
+                        int min = 0, max = -1;
+                        switch(*cur_)
+                        {
+                        case '*':
+                            break;
+                        case '+':
+                            min = 1;
+                            break;
+                        case '?':
+                            max = 1;
+                            break;
+                        case '{':
+                            ++cur_;
+                            min = max = parse_int();
+                            if(cur_ != end_ && *cur_ == ',')
+                            {
+                                ++cur_;
+                                max = cur_ != end_ && *cur_ == '}' ? -1 : parse_int();
+                            }
+                            if(cur_ == end_ || *cur_ != '}' || (-1 != max && max < min))
+                                fail(std::regex_constants::error_badbrace);
+                            break;
+                        default:
+                            return atom;
+                        }
+                        ++cur_;
+                        atom = add(repeat_k, atom);
+                        nodes_[static_cast<std::size_t>(atom)].min = min;
+                        nodes_[static_cast<std::size_t>(atom)].max = max;
+                    }
+                    return atom;
+                }
+                int parse_atom()
+                {
+                    char c = *cur_++;
+                    switch(c)
+                    {
+                    case '(':
+                    {
+                        if(cur_ != end_ && *cur_ == '?')
+                        {
+                            if(++cur_ == end_ || *cur_ != ':')
+                                fail(std::regex_constants::error_complexity);
+                            ++cur_;
+                        }
+                        int alt = parse_alt();
+                        if(cur_ == end_ || *cur_ != ')')
+                            fail(std::regex_constants::error_paren);
+                        ++cur_;
+                        return alt;
+                    }
+                    case '[':
+                        return add(parse_bracket());
+                    case '.':
+                        return add(~of("\n\r"));
+                    case '\\':
+                        return add(parse_escape());
+                    case '*': case '+': case '?': case '{':
+                        fail(std::regex_constants::error_badrepeat);
+                    case '^': case '$':
+                        // Anchors need more than one state per position.
+                        fail(std::regex_constants::error_complexity);
+                    default:
+                        return add(one(c));
+                    }
+                }
+                charset parse_escape()
+                {
+                    if(cur_ == end_)
+                        fail(std::regex_constants::error_escape);
+                    char c = *cur_++;
+                    charset const digit = range_of('0', '9');
+                    charset const word = digit | range_of('a', 'z') | range_of('A', 'Z') | of("_");
+                    charset const space = of(" \t\n\v\f\r");
+                    switch(c)
+                    {
+                    case 'd': return digit;
+                    case 'D': return ~digit;
+                    case 'w': return word;
+                    case 'W': return ~word;
+                    case 's': return space;
+                    case 'S': return ~space;
+                    case 'n': return one('\n');
+                    case 't': return one('\t');
+                    case 'r': return one('\r');
+                    case 'f': return one('\f');
+                    case 'v': return one('\v');
+                    case '0': return one('\0');
+                    default:
+                        // Word boundaries, back-references, unicode escapes, etc.
+                        if(word[static_cast<unsigned char>(c)])
+                            fail(std::regex_constants::error_escape);
+                        return one(c);
+                    }
+                }
+                int parse_class_char(charset &set)
+                {
+                    char c = *cur_++;
+                    if(c != '\\')
+                        return static_cast<unsigned char>(c);
+                    set = parse_escape();
+                    return single(set);
+                }
+                charset parse_bracket()
+                {
+                    charset set;
+                    bool negate = cur_ != end_ && *cur_ == '^';
+                    if(negate)
+                        ++cur_;
+                    while(true)
+                    {
+                        if(cur_ == end_)
+                            fail(std::regex_constants::error_brack);
+                        if(*cur_ == ']')
+                            break;
+                        charset item;
+                        int lo = parse_class_char(item);
+                        if(-1 == lo)
+                        {
+                            // A class escape like \d inside the brackets.
+                            set |= item;
+                            continue;
+                        }
+                        if(end_ - cur_ >= 2 && cur_[0] == '-' && cur_[1] != ']')
+                        {
+                            ++cur_;
+                            int hi = parse_class_char(item);
+                            if(-1 == hi || hi < lo)
+                                fail(std::regex_constants::error_range);
+                            set |= range_of(lo, hi);
+                        }
+                        else
+                            set.set(static_cast<std::size_t>(lo));
+                    }
+                    ++cur_;
+                    return negate ? ~set : set;
+                }
+
+                // Thompson construction
+                int state()
+                {
+                    nfa_.push_back(nfa_state{charset{}, -1, {-1, -1}});
+                    return static_cast<int>(nfa_.size()) - 1;
+                }
+                void eps(int from, int to)
+                {
+                    int (&e)[2] = nfa_[static_cast<std::size_t>(from)].eps;
+                    e[-1 == e[0] ? 0 : 1] = to;
+                }
+                fragment emit(int n)
+                {
+                    node const nd = nodes_[static_cast<std::size_t>(n)];
+                    switch(nd.kind)
+                    {
+                    case set_k:
+                    {
+                        int s = state(), e = state();
+                        nfa_[static_cast<std::size_t>(s)].set = nd.set;
+                        nfa_[static_cast<std::size_t>(s)].next = e;
+                        return {s, e};
+                    }
+                    case cat_k:
+                    {
+                        fragment a = emit(nd.lhs), b = emit(nd.rhs);
+                        eps(a.end, b.start);
+                        return {a.start, b.end};
+                    }
+                    case alt_k:
+                    {
+                        int s = state();
+                        fragment a = emit(nd.lhs), b = emit(nd.rhs);
+                        int e = state();
+                        eps(s, a.start);
+                        eps(s, b.start);
+                        eps(a.end, e);
+                        eps(b.end, e);
+                        return {s, e};
+                    }
+                    case repeat_k:
+                        return emit_repeat(nd.lhs, nd.min, nd.max);
+                    case empty_k:
+                    default:
+                    {
+                        int s = state(), e = state();
+                        eps(s, e);
+                        return {s, e};
+                    }
+                    }
+                }
+                fragment emit_repeat(int n, int min, int max)
+                {
+                    int s = state(), e = s;
+                    for(int i = 0; i < min; ++i)
+                    {
+                        fragment a = emit(n);
+                        eps(e, a.start);
+                        e = a.end;
+                    }
+                    if(-1 == max)
+                    {
+                        fragment a = emit(n);
+                        int t = state();
+                        eps(e, a.start);
+                        eps(e, t);
+                        eps(a.end, a.start);
+                        eps(a.end, t);
+                        return {s, t};
+                    }
+                    for(int i = min; i < max; ++i)
+                    {
+                        fragment a = emit(n);
+                        int t = state();
+                        eps(e, a.start);
+                        eps(e, t);
+                        eps(a.end, t);
+                        e = t;
+                    }
+                    return {s, e};
+                }
+
+                // Subset construction
+                void closure(std::vector<int> &states) const
+                {
+                    std::vector<char> seen(nfa_.size(), 0);
+                    std::vector<int> todo(states);
+                    states.clear();
+                    while(!todo.empty())
+                    {
+                        int s = todo.back();
+                        todo.pop_back();
+                        if(seen[static_cast<std::size_t>(s)])
+                            continue;
+                        seen[static_cast<std::size_t>(s)] = 1;
+                        states.push_back(s);
+                        for(int e : nfa_[static_cast<std::size_t>(s)].eps)
+                            if(-1 != e)
+                                todo.push_back(e);
+                    }
+                    std::sort(states.begin(), states.end());
+                }
+                void step(std::vector<int> const &states, std::size_t c,
+                    std::vector<int> &next) const
+                {
+                    next.clear();
+                    for(int s : states)
+                    {
+                        nfa_state const &st = nfa_[static_cast<std::size_t>(s)];
+                        if(-1 != st.next && st.set[c])
+                            next.push_back(st.next);
+                    }
+                    closure(next);
+                }
+
+                // The automaton for search follows the matches that start at every
+                // position up to the current one, in a state that lists the sets
+                // of NFA states reached from each start position, earliest first.
+                // An NFA state reached from an earlier start is dropped from later
+                // sets, since any match it leads to is better from the earlier
+                // start. Once one of the sets accepts, the later ones are dropped
+                // and no new ones are added, and the earlier ones are followed to
+                // see if they accept too, until none are left. At run time the
+                // start positions are kept in the same order as the sets.
+                struct search_state
+                {
+                    bool matched;
+                    std::vector<std::vector<int>> sets;
+                    std::vector<int> key() const
+                    {
+                        std::vector<int> k{matched};
+                        for(auto const &set : sets)
+                        {
+                            k.push_back(static_cast<int>(set.size()));
+                            k.insert(k.end(), set.begin(), set.end());
+                        }
+                        return k;
+                    }
+                };
+                bool compile_search(fragment f, std::size_t max_states, automaton &a) const
+                {
+                    std::vector<int> start{f.start};
+                    closure(start);
+                    std::vector<search_state> states{{true, {}}, {false, {start}}};
+                    std::map<std::vector<int>, int> ids;
+                    ids[states[0].key()] = 0;
+                    ids[states[1].key()] = 1;
+                    // Program 0 does nothing.
+                    std::map<std::vector<signed char>, int> moves;
+                    a.moves_.assign(2, 0);
+                    std::vector<int> next;
+                    std::vector<char> seen(nfa_.size(), 0);
+                    for(std::size_t i = 0; i < states.size(); ++i)
+                    {
+                        search_state const current = states[i];
+                        for(std::size_t c = 0; c < 256; ++c)
+                        {
+                            search_state to{current.matched, {}};
+                            // from[j] is the index of the start of the j-th set before
+                            // the move, or -1 for a set that starts here.
+                            std::vector<signed char> from;
+                            auto add = [&](int src, std::vector<int> const &set)
+                            {
+                                std::vector<int> rest;
+                                for(int s : set)
+                                    if(!seen[static_cast<std::size_t>(s)])
+                                    {
+                                        seen[static_cast<std::size_t>(s)] = 1;
+                                        rest.push_back(s);
+                                    }
+                                if(rest.empty())
+                                    return false;
+                                to.sets.push_back(std::move(rest));
+                                from.push_back(static_cast<signed char>(src));
+                                return true;
+                            };
+                            std::size_t hit = current.sets.size();
+                            for(std::size_t j = 0; j < current.sets.size(); ++j)
+                            {
+                                step(current.sets[j], c, next);
+                                if(add(static_cast<int>(j), next) &&
+                                    hit == current.sets.size() &&
+                                    std::binary_search(next.begin(), next.end(), f.end))
+                                    hit = to.sets.size() - 1;
+                            }
+                            if(hit != current.sets.size())
+                            {
+                                to.sets.resize(hit + 1);
+                                from.resize(hit + 1);
+                                to.matched = true;
+                            }
+                            else if(!to.matched)
+                                add(-1, start);
+                            for(auto const &set : to.sets)
+                                for(int s : set)
+                                    seen[static_cast<std::size_t>(s)] = 0;
+                            if(to.sets.size() > static_cast<std::size_t>(max_slots))
+                                return false;
+                            auto p = ids.insert(std::make_pair(to.key(),
+                                static_cast<int>(states.size())));
+                            if(p.second)
+                            {
+                                if(states.size() == max_states)
+                                    return false;
+                                states.push_back(std::move(to));
+                            }
+                            a.search_table_.push_back(p.first->second);
+
+                            // A move is stored from the first start that changes, as
+                            // that index, the number of starts, then their sources.
+                            std::size_t first = 0;
+                            while(first != from.size() &&
+                                from[first] == static_cast<signed char>(first))
+                                ++first;
+                            if(first == from.size())
+                                a.search_moves_.push_back(0);
+                            else
+                            {
+                                std::vector<signed char> move{
+                                    static_cast<signed char>(first),
+                                    static_cast<signed char>(from.size() - first)};
+                                move.insert(move.end(), from.begin() +
+                                    static_cast<std::ptrdiff_t>(first), from.end());
+                                auto q = moves.insert(std::make_pair(move,
+                                    static_cast<int>(a.moves_.size())));
+                                if(q.second)
+                                    a.moves_.insert(a.moves_.end(), move.begin(), move.end());
+                                a.search_moves_.push_back(q.first->second);
+                            }
+                        }
+                    }
+                    for(auto const &st : states)
+                        a.slots_ = std::max(a.slots_, static_cast<int>(st.sets.size()));
+                    for(auto const &st : states)
+                        a.found_.push_back(static_cast<signed char>(
+                            st.matched && !st.sets.empty() &&
+                            std::binary_search(st.sets.back().begin(), st.sets.back().end(),
+                                f.end) ?
+                            static_cast<int>(st.sets.size()) - 1 : -1));
+                    return true;
+                }
+            public:
+                automaton compile(std::string const &pattern, std::size_t max_states)
+                {
+                    cur_ = pattern.data();
+                    end_ = cur_ + pattern.size();
+                    int root = parse_alt();
+                    if(cur_ != end_)
+                        fail(std::regex_constants::error_paren);
+                    fragment f = emit(root);
+
+                    automaton a;
+                    std::map<std::vector<int>, int> ids;
+                    std::vector<std::vector<int>> sets(2);
+                    ids[sets[0]] = 0;
+                    sets[1].push_back(f.start);
+                    closure(sets[1]);
+                    ids[sets[1]] = 1;
+                    for(std::size_t i = 0; i < sets.size(); ++i)
+                    {
+                        a.table_.resize(sets.size() * 256, 0);
+                        std::vector<int> const current = sets[i];
+                        a.accept_.push_back(
+                            std::binary_search(current.begin(), current.end(), f.end));
+                        for(std::size_t c = 0; c < 256; ++c)
+                        {
+                            std::vector<int> next;
+                            step(current, c, next);
+                            auto p = ids.insert(std::make_pair(next, static_cast<int>(sets.size())));
+                            if(p.second)
+                            {
+                                if(sets.size() == max_states)
+                                    fail(std::regex_constants::error_complexity);
+                                sets.push_back(std::move(next));
+                            }
+                            a.table_.resize(sets.size() * 256, 0);
+                            a.table_[i * 256 + c] = p.first->second;
+                        }
+                    }
+                    if(!compile_search(f, max_states, a))
+                    {
+                        a.search_table_.clear();
+                        a.search_moves_.clear();
+                        a.moves_.clear();
+                        a.found_.clear();
+                        a.slots_ = 0;
+                    }
+                    return a;
+                }
+            };
+
+            std::shared_ptr<automaton const> dfa_;
+
+            template<typename I>
+            std::pair<I, I> search_each_(I first, I last) const
+            {
+                for(; first != last; ++first)
+                {
+                    I end = match(first, last);
+                    if(end != first)
+                        return {first, end};
+                }
+                return {last, last};
+            }
+            template<int Slots, typename I>
+            std::pair<I, I> search_(I first, I last) const
+            {
+                int const *table = dfa_->search_table_.data();
+                int const *moves = dfa_->search_moves_.data();
+                signed char const *move = dfa_->moves_.data();
+                signed char const *found = dfa_->found_.data();
+                I starts[Slots];
+                starts[0] = first;
+                std::pair<I, I> m{last, last};
+                for(int s = 1; first != last;)
+                {
+                    std::size_t const t = static_cast<std::size_t>(s) * 256 +
+                        static_cast<unsigned char>(*first);
+                    s = table[t];
+                    if(0 == s)
+                        break;
+                    ++first;
+                    if(int const mv = moves[t])
+                    {
+                        signed char const *p = move + mv;
+                        for(int j = 0; j < p[1]; ++j)
+                            starts[p[0] + j] = -1 == p[2 + j] ? first : starts[p[2 + j]];
+                    }
+                    if(-1 != found[s])
+                        m = {starts[found[s]], first};
+                }
+                return m;
+            }
+
+        public:
+            static constexpr std::size_t max_states = 4096;
+            /// The most start positions a search keeps track of at once.
+            static constexpr int max_slots = 16;
+
+            dfa_regex() = default;
+            explicit dfa_regex(std::string const &pattern)
+              : dfa_(std::make_shared<automaton>(compiler{}.compile(pattern, max_states)))
+            {}
+            explicit dfa_regex(char const *pattern)
+              : dfa_regex(std::string(pattern))
+            {}
+            /// The number of states in the automaton, including the dead state.
+            std::size_t states() const
+            {
+                return dfa_->accept_.size();
+            }
+            /// \return The end of the longest non-empty match that starts at \c first,
+            /// or \c first if there is none.
+            template<typename I, typename S>
+            I match(I first, S last) const
+            {
+                int const *table = dfa_->table_.data();
+                char const *accept = dfa_->accept_.data();
+                I end = first;
+                for(int s = 1; first != last;)
+                {
+                    s = table[s * 256 + static_cast<unsigned char>(*first)];
+                    if(0 == s)
+                        break;
+                    ++first;
+                    if(accept[s])
+                        end = first;
+                }
+                return end;
+            }
+            /// \return The leftmost-longest non-empty match in `[first, last)`, or
+            /// `{last, last}` if there is none.
+            ///
+            /// The text is read once, up to the end of the match and as far past
+            /// it as a longer match from the same start could go. Patterns that
+            /// would need more than \c max_states states or \c max_slots start
+            /// positions for that instead try \c match at each position in turn.
+            template<typename I>
+            std::pair<I, I> search(I first, I last) const
+            {
+                // The start positions are kept in an array no bigger than needed,
+                // which saves constructing iterators that are never used.
+                int const slots = dfa_->slots_;
+                return 0 == slots ? search_each_(first, last) :
+                    slots <= 2 ? search_<2>(first, last) :
+                    slots <= 4 ? search_<4>(first, last) :
+                        search_<max_slots>(first, last);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
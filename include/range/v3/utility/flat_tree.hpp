@@ -0,0 +1,382 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_FLAT_TREE_HPP
+#define RANGES_V3_UTILITY_FLAT_TREE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether two keys next to each other in sorted order are equivalent.
+            template<typename C>
+            struct flat_equivalent_
+            {
+                C const &comp_;
+                template<typename T, typename U>
+                bool operator()(T const &t, U const &u) const
+                {
+                    return !as_function(comp_)(t, u);
+                }
+            };
+
+            // The sorted vector of unique keys, or key/value pairs, that flat_set and
+            // flat_map are made of. KeyOf projects an element to its key.
+            template<typename T, typename Key, typename KeyOf, typename C, typename Alloc,
+                bool MutableElements>
+            struct flat_tree_
+            {
+            protected:
+                std::vector<T, Alloc> data_;
+                C comp_;
+
+                Key const &key_of(T const &t) const
+                {
+                    return KeyOf{}(t);
+                }
+                // Sorts and merges the elements from index `sorted` on, which
+                // were appended after the sorted and unique ones before them, and
+                // drops those whose keys came before. Where keys are equivalent, the
+                // element that came first is kept.
+                void merge_tail_(std::size_t sorted)
+                {
+                    auto const first = data_.begin();
+                    auto const middle = first + static_cast<std::ptrdiff_t>(sorted);
+                    auto const last = data_.end();
+                    if(middle == last)
+                        return;
+                    ranges::stable_sort(middle, last, comp_, KeyOf{});
+                    if(first == middle ||
+                        as_function(comp_)(key_of(*(middle - 1)), key_of(*middle)))
+                    {
+                        // The new keys all come after the old ones.
+                        data_.erase(ranges::unique(middle, last,
+                            detail::flat_equivalent_<C>{comp_}, KeyOf{}), last);
+                        return;
+                    }
+                    ranges::inplace_merge(first, middle, last, comp_, KeyOf{});
+                    data_.erase(ranges::unique(first, last, detail::flat_equivalent_<C>{comp_},
+                        KeyOf{}), data_.end());
+                }
+            public:
+                using key_type = Key;
+                using value_type = T;
+                using key_compare = C;
+                using allocator_type = Alloc;
+                using size_type = std::size_t;
+                using difference_type = std::ptrdiff_t;
+                using const_iterator = typename std::vector<T, Alloc>::const_iterator;
+                using iterator = meta::if_c<MutableElements,
+                    typename std::vector<T, Alloc>::iterator, const_iterator>;
+                using reference = meta::if_c<MutableElements, T &, T const &>;
+                using const_reference = T const &;
+                using reverse_iterator = std::reverse_iterator<iterator>;
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+                flat_tree_() = default;
+                explicit flat_tree_(C const &comp, Alloc const &alloc = Alloc())
+                  : data_(alloc), comp_(comp)
+                {}
+                template<typename I, typename S,
+                    CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value)>
+                flat_tree_(I first, S last, C const &comp = C(), Alloc const &alloc = Alloc())
+                  : data_(alloc), comp_(comp)
+                {
+                    insert(std::move(first), std::move(last));
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputRange<Rng>::value &&
+                        Constructible<T, range_reference_t<Rng>>::value &&
+                        !ConvertibleTo<Rng, T>::value &&
+                        !std::is_base_of<flat_tree_, uncvref_t<Rng>>::value)>
+                explicit flat_tree_(Rng && rng, C const &comp = C(), Alloc const &alloc = Alloc())
+                  : flat_tree_(ranges::begin(rng), ranges::end(rng), comp, alloc)
+                {}
+                flat_tree_(std::initializer_list<T> il, C const &comp = C(),
+                    Alloc const &alloc = Alloc())
+                  : flat_tree_(il.begin(), il.end(), comp, alloc)
+                {}
+
+                iterator begin()
+                {
+                    return data_.begin();
+                }
+                const_iterator begin() const
+                {
+                    return data_.begin();
+                }
+                const_iterator cbegin() const
+                {
+                    return data_.begin();
+                }
+                iterator end()
+                {
+                    return data_.end();
+                }
+                const_iterator end() const
+                {
+                    return data_.end();
+                }
+                const_iterator cend() const
+                {
+                    return data_.end();
+                }
+                reverse_iterator rbegin()
+                {
+                    return reverse_iterator{end()};
+                }
+                const_reverse_iterator rbegin() const
+                {
+                    return const_reverse_iterator{end()};
+                }
+                reverse_iterator rend()
+                {
+                    return reverse_iterator{begin()};
+                }
+                const_reverse_iterator rend() const
+                {
+                    return const_reverse_iterator{begin()};
+                }
+
+                bool empty() const
+                {
+                    return data_.empty();
+                }
+                size_type size() const
+                {
+                    return data_.size();
+                }
+                size_type max_size() const
+                {
+                    return data_.max_size();
+                }
+                size_type capacity() const
+                {
+                    return data_.capacity();
+                }
+                void reserve(size_type n)
+                {
+                    data_.reserve(n);
+                }
+                void shrink_to_fit()
+                {
+                    data_.shrink_to_fit();
+                }
+                void clear()
+                {
+                    data_.clear();
+                }
+                key_compare key_comp() const
+                {
+                    return comp_;
+                }
+                allocator_type get_allocator() const
+                {
+                    return data_.get_allocator();
+                }
+
+                /// Inserts \c t unless an element with an equivalent key is there
+                /// already. Returns the position of the element with that key, and
+                /// whether \c t was inserted. Linear in the size, for the move.
+                std::pair<iterator, bool> insert(T const &t)
+                {
+                    return insert_(T(t));
+                }
+                std::pair<iterator, bool> insert(T &&t)
+                {
+                    return insert_(std::move(t));
+                }
+                template<typename...Args,
+                    CONCEPT_REQUIRES_(Constructible<T, Args &&...>::value)>
+                std::pair<iterator, bool> emplace(Args &&...args)
+                {
+                    return insert_(T(std::forward<Args>(args)...));
+                }
+                /// As above, but if \c t goes just before \c hint, the search is
+                /// skipped.
+                iterator insert(const_iterator hint, T const &t)
+                {
+                    return insert_(hint, T(t));
+                }
+                iterator insert(const_iterator hint, T &&t)
+                {
+                    return insert_(hint, std::move(t));
+                }
+                /// Inserts the elements of a range whose keys aren't there already,
+                /// the first of any with equivalent keys. They are appended, sorted
+                /// and merged in, which takes O(m log m + n) for m new elements.
+                template<typename I, typename S,
+                    CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value &&
+                        Constructible<T, iterator_reference_t<I>>::value)>
+                void insert(I first, S last)
+                {
+                    std::size_t const sorted = data_.size();
+                    insert_back_(std::move(first), std::move(last), SizedIteratorRange<I, S>());
+                    merge_tail_(sorted);
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputRange<Rng>::value &&
+                        Constructible<T, range_reference_t<Rng>>::value &&
+                        !ConvertibleTo<Rng, T>::value)>
+                void insert(Rng && rng)
+                {
+                    insert(ranges::begin(rng), ranges::end(rng));
+                }
+                void insert(std::initializer_list<T> il)
+                {
+                    insert(il.begin(), il.end());
+                }
+
+                iterator erase(const_iterator pos)
+                {
+                    return data_.erase(pos);
+                }
+                iterator erase(const_iterator first, const_iterator last)
+                {
+                    return data_.erase(first, last);
+                }
+                size_type erase(Key const &key)
+                {
+                    auto const rng = equal_range(key);
+                    auto const n = static_cast<size_type>(rng.second - rng.first);
+                    data_.erase(rng.first, rng.second);
+                    return n;
+                }
+                void swap(flat_tree_ &that)
+                {
+                    using std::swap;
+                    data_.swap(that.data_);
+                    swap(comp_, that.comp_);
+                }
+
+                iterator lower_bound(Key const &key)
+                {
+                    return ranges::lower_bound(data_, key, comp_, KeyOf{});
+                }
+                const_iterator lower_bound(Key const &key) const
+                {
+                    return ranges::lower_bound(data_, key, comp_, KeyOf{});
+                }
+                iterator upper_bound(Key const &key)
+                {
+                    return ranges::upper_bound(data_, key, comp_, KeyOf{});
+                }
+                const_iterator upper_bound(Key const &key) const
+                {
+                    return ranges::upper_bound(data_, key, comp_, KeyOf{});
+                }
+                std::pair<iterator, iterator> equal_range(Key const &key)
+                {
+                    auto const it = lower_bound(key);
+                    return {it, it != end() && !as_function(comp_)(key, key_of(*it)) ?
+                        std::next(it) : it};
+                }
+                std::pair<const_iterator, const_iterator> equal_range(Key const &key) const
+                {
+                    auto const it = lower_bound(key);
+                    return {it, it != end() && !as_function(comp_)(key, key_of(*it)) ?
+                        std::next(it) : it};
+                }
+                iterator find(Key const &key)
+                {
+                    auto const rng = equal_range(key);
+                    return rng.first != rng.second ? rng.first : end();
+                }
+                const_iterator find(Key const &key) const
+                {
+                    auto const rng = equal_range(key);
+                    return rng.first != rng.second ? rng.first : end();
+                }
+                size_type count(Key const &key) const
+                {
+                    auto const rng = equal_range(key);
+                    return static_cast<size_type>(rng.second - rng.first);
+                }
+                bool contains(Key const &key) const
+                {
+                    return find(key) != end();
+                }
+
+                friend bool operator==(flat_tree_ const &x, flat_tree_ const &y)
+                {
+                    return x.data_ == y.data_;
+                }
+                friend bool operator!=(flat_tree_ const &x, flat_tree_ const &y)
+                {
+                    return !(x == y);
+                }
+                friend bool operator<(flat_tree_ const &x, flat_tree_ const &y)
+                {
+                    return x.data_ < y.data_;
+                }
+                friend void swap(flat_tree_ &x, flat_tree_ &y)
+                {
+                    x.swap(y);
+                }
+            private:
+                std::pair<iterator, bool> insert_(T &&t)
+                {
+                    auto const it = lower_bound(key_of(t));
+                    if(it != end() && !as_function(comp_)(key_of(t), key_of(*it)))
+                        return {it, false};
+                    return {data_.insert(it, std::move(t)), true};
+                }
+                iterator insert_(const_iterator hint, T &&t)
+                {
+                    auto &&comp = as_function(comp_);
+                    if((hint == data_.cbegin() || comp(key_of(*std::prev(hint)), key_of(t))) &&
+                        (hint == data_.cend() || comp(key_of(t), key_of(*hint))))
+                        return data_.insert(hint, std::move(t));
+                    return insert_(std::move(t)).first;
+                }
+                template<typename I, typename S>
+                void insert_back_(I first, S last, std::true_type)
+                {
+                    data_.reserve(data_.size() + static_cast<std::size_t>(last - first));
+                    insert_back_(std::move(first), std::move(last), std::false_type{});
+                }
+                template<typename I, typename S>
+                void insert_back_(I first, S last, std::false_type)
+                {
+                    for(; first != last; ++first)
+                        data_.emplace_back(*first);
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,375 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_HASH_SET_HPP
+#define RANGES_V3_UTILITY_HASH_SET_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The hash used when none is given: std::hash of the key.
+            struct default_hash_
+            {
+                template<typename T>
+                std::size_t operator()(T const &t) const
+                {
+                    return std::hash<T>{}(t);
+                }
+            };
+
+            // Keys that can be hashed by their bits: integers, enumerations and
+            // pointers, which are equal exactly when their bits are.
+            template<typename K>
+            using trivially_hashable_ = meta::fast_or<
+                std::is_integral<K>,
+                std::is_enum<K>,
+                std::is_pointer<K>>;
+
+            template<typename K>
+            std::uint64_t hash_bits_(K k, std::true_type) // integral or enum
+            {
+                return static_cast<std::uint64_t>(k);
+            }
+            template<typename K>
+            std::uint64_t hash_bits_(K *k, std::false_type) // pointer
+            {
+                return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(k));
+            }
+
+            // The slot of k in a table of 2^(64-shift) slots, by Fibonacci hashing.
+            template<typename K>
+            std::size_t hash_slot_(K k, int shift)
+            {
+                return static_cast<std::size_t>(
+                    (detail::hash_bits_(k, meta::bool_<!std::is_pointer<K>::value>{}) *
+                        0x9E3779B97F4A7C15ull) >> shift);
+            }
+
+            inline int hash_shift_(std::size_t slots)
+            {
+                int shift = 64;
+                for(; slots > 1; slots >>= 1)
+                    --shift;
+                return shift;
+            }
+
+            template<typename K, typename H>
+            struct key_hasher_
+            {
+                semiregular_t<function_type<H>> hash_;
+                std::size_t operator()(K const &k) const
+                {
+                    return static_cast<std::size_t>(hash_(k));
+                }
+            };
+
+            // An open-addressing set of keys that are their own hash, as a flat
+            // array of slots, linearly probed, no more than half full. The zero key
+            // marks an empty slot, so whether the set holds it is kept on the side.
+            template<typename K>
+            struct flat_hash_set_
+            {
+            private:
+                std::vector<K> slots_;
+                std::size_t size_ = 0;
+                int shift_ = 64;
+                bool has_zero_ = false;
+
+                std::size_t slot(K k) const
+                {
+                    return detail::hash_slot_(k, shift_);
+                }
+                void rehash(std::size_t n)
+                {
+                    std::vector<K> old(n, K{});
+                    old.swap(slots_);
+                    shift_ = detail::hash_shift_(n);
+                    std::size_t const mask = slots_.size() - 1;
+                    for(K k : old)
+                    {
+                        if(k == K{})
+                            continue;
+                        std::size_t i = slot(k);
+                        while(slots_[i] != K{})
+                            i = (i + 1) & mask;
+                        slots_[i] = k;
+                    }
+                }
+            public:
+                flat_hash_set_() = default;
+                // Only chosen when the hash is std::hash, which hashes the bits.
+                template<typename H>
+                explicit flat_hash_set_(H const &)
+                {}
+                /// Inserts \c k; returns whether it wasn't there already.
+                bool insert(K k)
+                {
+                    if(k == K{})
+                    {
+                        if(has_zero_)
+                            return false;
+                        has_zero_ = true;
+                        ++size_;
+                        return true;
+                    }
+                    if(2 * (size_ + 1) > slots_.size())
+                        rehash(slots_.empty() ? std::size_t(16) : 2 * slots_.size());
+                    std::size_t const mask = slots_.size() - 1;
+                    for(std::size_t i = slot(k);; i = (i + 1) & mask)
+                    {
+                        K &s = slots_[i];
+                        if(s == K{})
+                        {
+                            s = k;
+                            ++size_;
+                            return true;
+                        }
+                        if(s == k)
+                            return false;
+                    }
+                }
+                bool contains(K k) const
+                {
+                    if(k == K{})
+                        return has_zero_;
+                    if(slots_.empty())
+                        return false;
+                    std::size_t const mask = slots_.size() - 1;
+                    for(std::size_t i = slot(k);; i = (i + 1) & mask)
+                    {
+                        if(slots_[i] == k)
+                            return true;
+                        if(slots_[i] == K{})
+                            return false;
+                    }
+                }
+                std::size_t size() const
+                {
+                    return size_;
+                }
+                /// Makes room for \c n keys without rehashing.
+                void reserve(std::size_t n)
+                {
+                    std::size_t cap = 16;
+                    while(cap < 2 * n)
+                        cap *= 2;
+                    if(cap > slots_.size())
+                        rehash(cap);
+                }
+                /// Empties the set, keeping its slots.
+                void clear()
+                {
+                    std::fill(slots_.begin(), slots_.end(), K{});
+                    size_ = 0;
+                    has_zero_ = false;
+                }
+            };
+
+            // Any other key, in a std::unordered_set.
+            template<typename K, typename H>
+            struct node_hash_set_
+            {
+            private:
+                std::unordered_set<K, key_hasher_<K, H>, equal_to> set_;
+            public:
+                node_hash_set_() = default;
+                explicit node_hash_set_(H hash)
+                  : set_(0, key_hasher_<K, H>{as_function(std::move(hash))})
+                {}
+                template<typename T>
+                bool insert(T &&t)
+                {
+                    return set_.insert(static_cast<T &&>(t)).second;
+                }
+                bool contains(K const &k) const
+                {
+                    return set_.count(k) != 0;
+                }
+                std::size_t size() const
+                {
+                    return set_.size();
+                }
+                void reserve(std::size_t n)
+                {
+                    set_.reserve(n);
+                }
+                void clear()
+                {
+                    set_.clear();
+                }
+            };
+
+            // A set of the keys seen so far, for algorithms that hash. The flat set
+            // is used when the hash would be std::hash of a key that is its own hash.
+            template<typename K, typename H>
+            using hash_set_ =
+                meta::if_<
+                    meta::and_<
+                        trivially_hashable_<K>,
+                        meta::or_<std::is_same<H, default_hash_>, std::is_same<H, std::hash<K>>>>,
+                    flat_hash_set_<K>,
+                    node_hash_set_<K, H>>;
+
+            // Maps keys that are their own hash to the indices they were given when
+            // they were inserted, in a flat array of slots of keys and indices,
+            // linearly probed, no more than half full. An empty slot has no index.
+            template<typename K>
+            struct flat_hash_index_
+            {
+            private:
+                struct slot_t
+                {
+                    K key;
+                    std::size_t index;
+                };
+                static std::size_t npos()
+                {
+                    return static_cast<std::size_t>(-1);
+                }
+                std::vector<slot_t> slots_;
+                std::size_t size_ = 0;
+                int shift_ = 64;
+
+                void rehash(std::size_t n)
+                {
+                    std::vector<slot_t> old(n, slot_t{K{}, npos()});
+                    old.swap(slots_);
+                    shift_ = detail::hash_shift_(n);
+                    std::size_t const mask = slots_.size() - 1;
+                    for(slot_t const &s : old)
+                    {
+                        if(s.index == npos())
+                            continue;
+                        std::size_t i = detail::hash_slot_(s.key, shift_);
+                        while(slots_[i].index != npos())
+                            i = (i + 1) & mask;
+                        slots_[i] = s;
+                    }
+                }
+            public:
+                flat_hash_index_() = default;
+                // Only chosen when the hash is std::hash, which hashes the bits.
+                template<typename H>
+                explicit flat_hash_index_(H const &)
+                {}
+                /// The index of \c k, which is \c next if it wasn't there before, and
+                /// whether it wasn't.
+                std::pair<std::size_t, bool> insert(K k, std::size_t next)
+                {
+                    if(2 * (size_ + 1) > slots_.size())
+                        rehash(slots_.empty() ? std::size_t(16) : 2 * slots_.size());
+                    std::size_t const mask = slots_.size() - 1;
+                    for(std::size_t i = detail::hash_slot_(k, shift_);; i = (i + 1) & mask)
+                    {
+                        slot_t &s = slots_[i];
+                        if(s.index == npos())
+                        {
+                            s = slot_t{k, next};
+                            ++size_;
+                            return {next, true};
+                        }
+                        if(s.key == k)
+                            return {s.index, false};
+                    }
+                }
+                /// The index of \c k, or `std::size_t(-1)` if it isn't there.
+                std::size_t find(K k) const
+                {
+                    if(slots_.empty())
+                        return npos();
+                    std::size_t const mask = slots_.size() - 1;
+                    for(std::size_t i = detail::hash_slot_(k, shift_);; i = (i + 1) & mask)
+                    {
+                        slot_t const &s = slots_[i];
+                        if(s.index == npos() || s.key == k)
+                            return s.index;
+                    }
+                }
+                std::size_t size() const
+                {
+                    return size_;
+                }
+                void reserve(std::size_t n)
+                {
+                    std::size_t cap = 16;
+                    while(cap < 2 * n)
+                        cap *= 2;
+                    if(cap > slots_.size())
+                        rehash(cap);
+                }
+            };
+
+            template<typename K, typename H>
+            struct node_hash_index_
+            {
+            private:
+                std::unordered_map<K, std::size_t, key_hasher_<K, H>, equal_to> map_;
+            public:
+                node_hash_index_() = default;
+                explicit node_hash_index_(H hash)
+                  : map_(0, key_hasher_<K, H>{as_function(std::move(hash))})
+                {}
+                template<typename T>
+                std::pair<std::size_t, bool> insert(T &&t, std::size_t next)
+                {
+                    auto const res = map_.emplace(static_cast<T &&>(t), next);
+                    return {res.first->second, res.second};
+                }
+                std::size_t find(K const &k) const
+                {
+                    auto const it = map_.find(k);
+                    return it == map_.end() ? static_cast<std::size_t>(-1) : it->second;
+                }
+                std::size_t size() const
+                {
+                    return map_.size();
+                }
+                void reserve(std::size_t n)
+                {
+                    map_.reserve(n);
+                }
+            };
+
+            // Numbers keys in the order they are first inserted, for algorithms that
+            // keep a dense array of something per key.
+            template<typename K, typename H>
+            using hash_index_ =
+                meta::if_<
+                    meta::and_<
+                        trivially_hashable_<K>,
+                        meta::or_<std::is_same<H, default_hash_>, std::is_same<H, std::hash<K>>>>,
+                    flat_hash_index_<K>,
+                    node_hash_index_<K, H>>;
+        }
+        /// \endcond
+    }
+}
+
+#endif
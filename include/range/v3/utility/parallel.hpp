@@ -0,0 +1,116 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_PARALLEL_HPP
+#define RANGES_V3_UTILITY_PARALLEL_HPP
+
+#include <thread>
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <exception>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// \brief Asks for work on a range to be split among several threads, as in
+        /// `rng | to_vector(par)`. Each use says which ranges it splits, and does the
+        /// work on the calling thread for any other range, or one too small to be
+        /// worth splitting. The range is read concurrently, so whatever it calls,
+        /// like the function of a \c view::transform, must be safe to call from
+        /// several threads at once. If a thread throws, the exception is rethrown
+        /// after all threads have finished.
+        struct parallel_t
+        {
+            /// The most threads to use, counting the calling one; 0 means
+            /// `std::thread::hardware_concurrency()`.
+            unsigned threads;
+        };
+
+        namespace
+        {
+            constexpr auto&& par = static_const<parallel_t>::value;
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // How many slices to split n elements into, so that no slice has fewer
+            // than grain elements. Fewer than 2 means don't split.
+            inline std::size_t slice_count_(std::size_t n, parallel_t policy, std::size_t grain)
+            {
+                std::size_t k = 0 != policy.threads ? policy.threads :
+                    std::thread::hardware_concurrency();
+                return n / grain < k ? n / grain : k;
+            }
+
+            // The bounds of the i-th of k slices of n elements, which differ in size
+            // by one at most.
+            inline std::pair<std::size_t, std::size_t>
+            slice_bounds_(std::size_t n, std::size_t k, std::size_t i)
+            {
+                std::size_t const lo = n / k * i + (i < n % k ? i : n % k);
+                return {lo, lo + n / k + (i < n % k)};
+            }
+
+            // Calls fun(i) for each i in [0,k), the first on the calling thread and
+            // each of the others on a thread of its own, and waits for them all.
+            // Rethrows the exception of the lowest i that threw, if any. If a thread
+            // can't be started, its calls are made on the calling thread.
+            template<typename Fun>
+            void run_slices_(std::size_t k, Fun fun)
+            {
+                std::unique_ptr<std::exception_ptr[]> errors{new std::exception_ptr[k]};
+                auto run = [&](std::size_t i)
+                {
+                    try
+                    {
+                        fun(i);
+                    }
+                    catch(...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                };
+                std::unique_ptr<std::thread[]> workers{new std::thread[k - 1]};
+                std::size_t started = 0;
+                try
+                {
+                    for(; started != k - 1; ++started)
+                        workers[started] = std::thread{run, started + 1};
+                }
+                catch(...)
+                {
+                    for(std::size_t i = started + 1; i != k; ++i)
+                        run(i);
+                }
+                run(0);
+                for(std::size_t i = 0; i != started; ++i)
+                    workers[i].join();
+                for(std::size_t i = 0; i != k; ++i)
+                    if(errors[i])
+                        std::rethrow_exception(errors[i]);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,434 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_SINK_HPP
+#define RANGES_V3_UTILITY_SINK_HPP
+
+#include <cmath>
+#include <cerrno>
+#include <cstdio>
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+#include <system_error>
+#include <range/v3/range_fwd.hpp>
+#include <meta/meta.hpp>
+#include <range/v3/utility/concepts.hpp>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Writes the digits of u backwards, ending at last, two at a time.
+            inline char *format_digits_(char *last, unsigned long long u)
+            {
+                static char const pairs[] =
+                    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                    "8081828384858687888990919293949596979899";
+                for(; u >= 100; u /= 100)
+                {
+                    last -= 2;
+                    std::memcpy(last, pairs + (u % 100) * 2, 2);
+                }
+                if(u >= 10)
+                {
+                    last -= 2;
+                    std::memcpy(last, pairs + u * 2, 2);
+                }
+                else
+                    *--last = static_cast<char>('0' + u);
+                return last;
+            }
+
+            inline char *format_number_(char *out, unsigned long long u, int)
+            {
+                char buf[24];
+                char *first = format_digits_(buf + sizeof(buf), u);
+                std::size_t const n = static_cast<std::size_t>(buf + sizeof(buf) - first);
+                std::memcpy(out, first, n);
+                return out + n;
+            }
+
+            inline char *format_number_(char *out, long long i, int precision)
+            {
+                if(i < 0)
+                {
+                    *out++ = '-';
+                    return format_number_(out, 0ull - static_cast<unsigned long long>(i),
+                        precision);
+                }
+                return format_number_(out, static_cast<unsigned long long>(i), precision);
+            }
+
+            // Formats like `%.*g`, which is what an ostream does with default flags.
+            // Numbers that `%g` writes in fixed notation are scaled to an integer of
+            // `precision` digits with one multiplication by an exact power of ten,
+            // which is off by at most half an ulp; unless that could change how it
+            // rounds, the digits are written out directly. Everything else goes to
+            // snprintf.
+            inline char *format_number_(char *out, double d, int precision)
+            {
+                static double const pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19};
+                double const a = std::fabs(d);
+                if(precision <= 15 && a < pow10[precision] && !(0 == d && std::signbit(d)))
+                {
+                    if(a == std::floor(a))
+                        return format_number_(out, static_cast<long long>(d), precision);
+                    int e = precision - 1;
+                    while(e > 0 && a < pow10[e])
+                        --e;
+                    while(e <= 0 && e > -5 && a * pow10[-e] < 1)
+                        --e;
+                    double const scaled = a * pow10[precision - 1 - e];
+                    double const whole = std::floor(scaled), frac = scaled - whole;
+                    if(e > -5 && scaled >= pow10[precision - 1] && scaled < pow10[precision] &&
+                        std::fabs(frac - 0.5) > scaled * 1e-15)
+                    {
+                        auto n = static_cast<unsigned long long>(whole) + (frac > 0.5);
+                        if(n == static_cast<unsigned long long>(pow10[precision]))
+                        {
+                            n /= 10;
+                            ++e;
+                        }
+                        if(e < precision)
+                        {
+                            char digits[24];
+                            char *const last = digits + sizeof(digits);
+                            char *first = format_digits_(last, n), *end = last;
+                            while(end[-1] == '0')
+                                --end;
+                            if(d < 0)
+                                *out++ = '-';
+                            if(e < 0)
+                            {
+                                *out++ = '0';
+                                *out++ = '.';
+                                for(int i = -1; i > e; --i)
+                                    *out++ = '0';
+                            }
+                            else
+                            {
+                                for(int i = 0; i <= e; ++i)
+                                    *out++ = first < end ? *first++ : '0';
+                                if(first != end)
+                                    *out++ = '.';
+                            }
+                            while(first != end)
+                                *out++ = *first++;
+                            return out;
+                        }
+                    }
+                }
+                int const n = std::snprintf(out, 64, "%.*g", precision, d);
+                return out + (n > 0 ? n : 0);
+            }
+            // Keeps the digits a long double has beyond a double's.
+            inline char *format_number_(char *out, long double d, int precision)
+            {
+                int const n = std::snprintf(out, 64, "%.*Lg", precision, d);
+                return out + (n > 0 ? n : 0);
+            }
+
+            template<typename T, bool = std::is_signed<T>::value>
+            struct sink_number_
+            {
+                using type = long long;
+            };
+            template<typename T>
+            struct sink_number_<T, false>
+            {
+                using type = unsigned long long;
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-utility
+        /// @{
+
+        /// \brief The buffering and formatting shared by \c ostream_sink and \c fd_sink.
+        ///
+        /// Numbers and strings are formatted straight into a buffer, which is handed to
+        /// \c Derived's `write_(char const *, std::size_t)` when it fills up, when
+        /// `flush()` is called, and when the sink is destroyed. Each value written
+        /// through the sink's iterator, `out()`, is followed by the separator, if any.
+        /// Integers and characters are written as an ostream with default flags would
+        /// write them; floating-point numbers are written like `%.*g` with the sink's
+        /// precision, which defaults to the ostream default of 6.
+        template<typename Derived>
+        struct basic_sink
+        {
+        private:
+            // Room for any one number, so numbers are never split across writes.
+            enum : std::size_t { max_number_size = 64 };
+            std::unique_ptr<char[]> buf_;
+            std::size_t capacity_, size_;
+            std::string sep_;
+            int precision_;
+
+            Derived &derived()
+            {
+                return static_cast<Derived &>(*this);
+            }
+            char *reserve(std::size_t n)
+            {
+                if(capacity_ - size_ < n)
+                    flush();
+                return buf_.get() + size_;
+            }
+            template<typename T>
+            void put_number(T t)
+            {
+                char *out = reserve(max_number_size);
+                size_ = static_cast<std::size_t>(
+                    detail::format_number_(out, t, precision_) - buf_.get());
+            }
+        protected:
+            // Derived sinks flush in their destructors, while they can still write.
+            ~basic_sink() = default;
+        public:
+            struct iterator;
+
+            explicit basic_sink(char const *sep = nullptr,
+                std::size_t buffer_size = std::size_t(1) << 16)
+              : buf_(), capacity_(buffer_size < max_number_size ? std::size_t(max_number_size) :
+                    buffer_size)
+              , size_(0), sep_(sep ? sep : ""), precision_(6)
+            {
+                buf_.reset(new char[capacity_]);
+            }
+            basic_sink(basic_sink const &) = delete;
+            basic_sink &operator=(basic_sink const &) = delete;
+
+            /// Writes \c n characters unformatted.
+            void write(char const *str, std::size_t n)
+            {
+                if(capacity_ - size_ < n)
+                {
+                    flush();
+                    if(capacity_ < n)
+                    {
+                        derived().write_(str, n);
+                        return;
+                    }
+                }
+                std::memcpy(buf_.get() + size_, str, n);
+                size_ += n;
+            }
+            void put(char c)
+            {
+                *reserve(1) = c;
+                ++size_;
+            }
+            void put(signed char c)
+            {
+                put(static_cast<char>(c));
+            }
+            void put(unsigned char c)
+            {
+                put(static_cast<char>(c));
+            }
+            void put(char const *str)
+            {
+                write(str, std::strlen(str));
+            }
+            void put(std::string const &str)
+            {
+                write(str.data(), str.size());
+            }
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_integral<T>::value && 1 < sizeof(T))>
+            void put(T t)
+            {
+                put_number(static_cast<meta::_t<detail::sink_number_<T>>>(t));
+            }
+            void put(bool b)
+            {
+                put(static_cast<char>('0' + b));
+            }
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_floating_point<T>::value &&
+                    !std::is_same<T, long double>::value)>
+            void put(T t)
+            {
+                put_number(static_cast<double>(t));
+            }
+            void put(long double t)
+            {
+                put_number(t);
+            }
+            /// Writes \c t and then the separator.
+            template<typename T>
+            void put_element(T const &t)
+            {
+                put(t);
+                if(!sep_.empty())
+                    write(sep_.data(), sep_.size());
+            }
+            /// The number of significant digits floating-point numbers are written with.
+            int precision() const
+            {
+                return precision_;
+            }
+            void precision(int p)
+            {
+                precision_ = p < 1 ? 1 : p > 40 ? 40 : p;
+            }
+            /// Writes everything buffered so far.
+            void flush()
+            {
+                if(0 != size_)
+                {
+                    std::size_t const n = size_;
+                    size_ = 0;
+                    derived().write_(buf_.get(), n);
+                }
+            }
+            /// An output iterator, for use with `copy`, `transform` and the like,
+            /// that writes each value assigned through it, then the separator.
+            iterator out()
+            {
+                return iterator{derived()};
+            }
+        };
+
+        template<typename Derived>
+        struct basic_sink<Derived>::iterator
+        {
+        private:
+            basic_sink *sink_;
+            struct proxy
+            {
+                basic_sink *sink_;
+                template<typename T,
+                    typename = decltype(std::declval<basic_sink &>().put(std::declval<T const &>()))>
+                proxy &operator=(T const &t)
+                {
+                    sink_->put_element(t);
+                    return *this;
+                }
+            };
+        public:
+            using difference_type = std::ptrdiff_t;
+            iterator() = default;
+            explicit iterator(basic_sink &sink) noexcept
+              : sink_(&sink)
+            {}
+            proxy operator*() const noexcept
+            {
+                return {sink_};
+            }
+            iterator &operator++()
+            {
+                return *this;
+            }
+            iterator &operator++(int)
+            {
+                return *this;
+            }
+        };
+
+        /// \brief A \c basic_sink that writes to a \c std::ostream.
+        ///
+        /// The stream sees one unformatted `write` per buffer. Failures are reported
+        /// the way the stream reports them, by its state and its exception mask.
+        struct ostream_sink
+          : basic_sink<ostream_sink>
+        {
+        private:
+            friend basic_sink<ostream_sink>;
+            std::ostream *sout_;
+            void write_(char const *str, std::size_t n)
+            {
+                sout_->write(str, static_cast<std::streamsize>(n));
+            }
+        public:
+            explicit ostream_sink(std::ostream &sout, char const *sep = nullptr,
+                std::size_t buffer_size = std::size_t(1) << 16)
+              : basic_sink<ostream_sink>(sep, buffer_size), sout_(&sout)
+            {}
+            ~ostream_sink()
+            {
+                try
+                {
+                    flush();
+                }
+                catch(...)
+                {}
+            }
+        };
+
+        /// \brief A \c basic_sink that writes to a file descriptor.
+        ///
+        /// Throws `std::system_error` if a write fails. The descriptor is not closed.
+        /// Anything still buffered when the sink is destroyed is written then, and
+        /// errors are ignored; call `flush()` first to see them.
+        struct fd_sink
+          : basic_sink<fd_sink>
+        {
+        private:
+            friend basic_sink<fd_sink>;
+            int fd_;
+            void write_(char const *str, std::size_t n)
+            {
+                while(0 != n)
+                {
+#ifdef _WIN32
+                    int const m = ::_write(fd_, str,
+                        static_cast<unsigned>(n < (1u << 30) ? n : (1u << 30)));
+#else
+                    ::ssize_t const m = ::write(fd_, str, n);
+#endif
+                    if(m < 0)
+                    {
+                        if(EINTR == errno)
+                            continue;
+                        throw std::system_error(errno, std::system_category(), "write");
+                    }
+                    str += m;
+                    n -= static_cast<std::size_t>(m);
+                }
+            }
+        public:
+            explicit fd_sink(int fd, char const *sep = nullptr,
+                std::size_t buffer_size = std::size_t(1) << 16)
+              : basic_sink<fd_sink>(sep, buffer_size), fd_(fd)
+            {}
+            ~fd_sink()
+            {
+                try
+                {
+                    flush();
+                }
+                catch(...)
+                {}
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -29,6 +29,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/chunk.hpp>
 #include <range/v3/view/cycle.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/distinct.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/empty.hpp>
@@ -37,13 +38,18 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/generate.hpp>
 #include <range/v3/view/generate_n.hpp>
 #include <range/v3/view/group_by.hpp>
+#include <range/v3/view/hash_join.hpp>
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/intersperse.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/merge_join.hpp>
 #include <range/v3/view/move.hpp>
+#include <range/v3/view/parse.hpp>
 #include <range/v3/view/partial_sum.hpp>
+#include <range/v3/view/partition_lines.hpp>
+#include <range/v3/view/prepare.hpp>
 #include <range/v3/view/repeat.hpp>
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/remove_if.hpp>
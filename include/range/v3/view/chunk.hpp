@@ -16,6 +16,7 @@
 
 #include <utility>
 #include <functional>
+#include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -24,6 +25,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_adaptor.hpp>
+#include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/take.hpp>
@@ -34,21 +36,42 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Lvalue ranges whose elements are laid out contiguously in memory,
+            // like std::vector and std::array; view::chunk splits them into
+            // ranges of pointers.
+            template<typename Rng, typename Enable = void>
+            struct is_contiguous_range_
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_contiguous_range_<Rng, meta::if_<std::is_same<
+                    decltype(std::declval<Rng &>().data()),
+                    meta::_t<std::add_pointer<range_reference_t<Rng>>>>>>
+              : meta::and_<
+                    std::is_lvalue_reference<Rng>,
+                    RandomAccessRange<Rng>,
+                    SizedRange<Rng>>
+            {};
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
+        template<typename Rng, bool IsForwardRange = ForwardRange<Rng>::value>
+        struct chunk_view;
+
         template<typename Rng>
-        struct chunk_view
+        struct chunk_view<Rng, true>
           : view_adaptor<
-                chunk_view<Rng>,
+                chunk_view<Rng, true>,
                 Rng,
                 is_finite<Rng>::value ? finite : range_cardinality<Rng>::value>
         {
         private:
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-            CONCEPT_ASSERT(ForwardRange<Rng>::value);
-#else
-            CONCEPT_ASSERT(ForwardRange<Rng>());
-#endif
             using offset_t =
                 meta::if_<
                     BidirectionalRange<Rng>,
@@ -86,7 +109,7 @@ namespace ranges
         };
 
         template<typename Rng>
-        struct chunk_view<Rng>::adaptor
+        struct chunk_view<Rng, true>::adaptor
           : adaptor_base, private box<offset_t>
         {
         private:
@@ -99,6 +122,9 @@ namespace ranges
             adaptor(range_difference_t<Rng> n, range_sentinel_t<Rng> end)
               : box<offset_t>{0}, n_(n), end_(end)
             {}
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(!(RandomAccessRange<BaseRng>::value &&
+                    SizedIteratorRange<range_iterator_t<BaseRng>, range_sentinel_t<BaseRng>>::value))>
             auto current(range_iterator_t<Rng> it) const ->
                 decltype(view::take(make_range(std::move(it), end_), n_))
             {
@@ -106,6 +132,18 @@ namespace ranges
                 RANGES_ASSERT(0 == offset());
                 return view::take(make_range(std::move(it), end_), n_);
             }
+            // The end of the chunk can be found in O(1), so the chunk is a subrange
+            // of the base range; over pointers, a span of contiguous elements.
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(RandomAccessRange<BaseRng>::value &&
+                    SizedIteratorRange<range_iterator_t<BaseRng>, range_sentinel_t<BaseRng>>::value)>
+            range<range_iterator_t<Rng>> current(range_iterator_t<Rng> it) const
+            {
+                RANGES_ASSERT(it != end_);
+                RANGES_ASSERT(0 == offset());
+                auto last = ranges::next(it, n_, end_);
+                return {std::move(it), std::move(last)};
+            }
             void next(range_iterator_t<Rng> &it)
             {
                 RANGES_ASSERT(it != end_);
@@ -148,6 +186,112 @@ namespace ranges
             }
         };
 
+        // Chunking a single-pass range: each chunk is read directly from the
+        // underlying range, which the chunks share, so nothing is buffered and
+        // no element is read twice. Advancing to the next chunk skips whatever
+        // is left of the current one.
+        template<typename Rng>
+        struct chunk_view<Rng, false>
+          : view_facade<
+                chunk_view<Rng, false>,
+                is_finite<Rng>::value ? finite : range_cardinality<Rng>::value>
+        {
+        private:
+            friend range_access;
+            CONCEPT_ASSERT(InputRange<Rng>::value);
+            Rng rng_;
+            range_difference_t<Rng> n_;
+            range_difference_t<Rng> remainder_;
+            range_iterator_t<Rng> it_;
+
+            struct inner_view
+              : view_facade<inner_view, finite>
+            {
+            private:
+                friend range_access;
+                chunk_view *rng_;
+
+                struct cursor
+                {
+                private:
+                    chunk_view *rng_;
+                public:
+                    cursor() = default;
+                    explicit cursor(chunk_view &rng)
+                      : rng_(&rng)
+                    {}
+                    auto current() const ->
+                        decltype(*rng_->it_)
+                    {
+                        return *rng_->it_;
+                    }
+                    void next()
+                    {
+                        ++rng_->it_;
+                        --rng_->remainder_;
+                    }
+                    bool done() const
+                    {
+                        return 0 == rng_->remainder_ || rng_->it_ == ranges::end(rng_->rng_);
+                    }
+                };
+                cursor begin_cursor() const
+                {
+                    return cursor{*rng_};
+                }
+            public:
+                inner_view() = default;
+                explicit inner_view(chunk_view &rng)
+                  : rng_(&rng)
+                {}
+            };
+
+            struct cursor
+            {
+            private:
+                chunk_view *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(chunk_view &rng)
+                  : rng_(&rng)
+                {}
+                inner_view current() const
+                {
+                    return inner_view{*rng_};
+                }
+                void next()
+                {
+                    ranges::advance(rng_->it_, rng_->remainder_, ranges::end(rng_->rng_));
+                    rng_->remainder_ = rng_->n_;
+                }
+                bool done() const
+                {
+                    return rng_->it_ == ranges::end(rng_->rng_);
+                }
+            };
+            cursor begin_cursor()
+            {
+                it_ = ranges::begin(rng_);
+                remainder_ = n_;
+                return cursor{*this};
+            }
+        public:
+            chunk_view() = default;
+            chunk_view(Rng rng, range_difference_t<Rng> n)
+              : rng_(std::move(rng)), n_(n), remainder_(n), it_{}
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
         namespace view
         {
             // In:  Range<T>
@@ -170,15 +314,23 @@ namespace ranges
                 )
             public:
                 template<typename Rng,
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                    CONCEPT_REQUIRES_(ForwardRange<Rng>::value)>
-#else
-                    CONCEPT_REQUIRES_(ForwardRange<Rng>())>
-#endif
+                    CONCEPT_REQUIRES_(InputRange<Rng>::value &&
+                        !detail::is_contiguous_range_<Rng>::value)>
                 chunk_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n) const
                 {
                     return {all(std::forward<Rng>(rng)), n};
                 }
+                /// \overload
+                /// The elements of a contiguous container are chunked through pointers,
+                /// so that each chunk is a \c range of pointers.
+                template<typename Rng,
+                    typename P = meta::_t<std::add_pointer<range_reference_t<Rng>>>,
+                    CONCEPT_REQUIRES_(detail::is_contiguous_range_<Rng>::value)>
+                chunk_view<range<P>> operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    P data = rng.data();
+                    return {range<P>{data, data + ranges::distance(rng)}, n};
+                }
 
                 // For the sake of better error messages:
             #ifndef RANGES_DOXYGEN_INVOKED
@@ -198,14 +350,14 @@ namespace ranges
             public:
                 template<typename Rng, typename T,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                    CONCEPT_REQUIRES_(!(ForwardRange<Rng>::value && Integral<T>::value))>
+                    CONCEPT_REQUIRES_(!(InputRange<Rng>::value && Integral<T>::value))>
 #else
-                    CONCEPT_REQUIRES_(!(ForwardRange<Rng>() && Integral<T>()))>
+                    CONCEPT_REQUIRES_(!(InputRange<Rng>() && Integral<T>()))>
 #endif
                 void operator()(Rng &&, T) const
                 {
-                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
-                        "The first argument to view::chunk must be a model of the ForwardRange concept");
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The first argument to view::chunk must be a model of the InputRange concept");
                     CONCEPT_ASSERT_MSG(Integral<T>(),
                         "The second argument to view::chunk must be a model of the Integral concept");
                 }
@@ -59,6 +59,40 @@ namespace ranges
                             State::value == finite || Value::value == finite ?
                                 finite :
                                 static_cast<cardinality>(State::value + Value::value)>;
+
+            // The position at which a concatenated segment ends, suitable as the
+            // bound of ranges::advance and ranges::distance. For sized random-access
+            // segments this is an iterator computed in O(1), which makes bounded
+            // advance and distance O(1) even when the segment's sentinel is not an
+            // iterator.
+            template<typename Rng,
+                CONCEPT_REQUIRES_(SizedRange<Rng>::value && RandomAccessRange<Rng>::value)>
+            range_iterator_t<Rng> concat_segment_bound(Rng &rng)
+            {
+                return ranges::begin(rng) +
+                    static_cast<range_difference_t<Rng>>(ranges::size(rng));
+            }
+            template<typename Rng,
+                CONCEPT_REQUIRES_(!(SizedRange<Rng>::value && RandomAccessRange<Rng>::value))>
+            range_sentinel_t<Rng> concat_segment_bound(Rng &rng)
+            {
+                return ranges::end(rng);
+            }
+
+            // An iterator to the end of a concatenated segment; O(1) for sized
+            // random-access and for bounded random-access segments.
+            template<typename Rng,
+                CONCEPT_REQUIRES_(SizedRange<Rng>::value && RandomAccessRange<Rng>::value)>
+            range_iterator_t<Rng> concat_segment_last(Rng &rng)
+            {
+                return detail::concat_segment_bound(rng);
+            }
+            template<typename Rng,
+                CONCEPT_REQUIRES_(!(SizedRange<Rng>::value && RandomAccessRange<Rng>::value))>
+            range_iterator_t<Rng> concat_segment_last(Rng &rng)
+            {
+                return ranges::next(ranges::begin(rng), ranges::end(rng));
+            }
         }
         /// \endcond
 
@@ -148,9 +182,8 @@ namespace ranges
                         if(it == begin(std::get<N>(pos->rng_->rngs_)))
 #endif
                         {
-                            auto &&rng = std::get<N - 1>(pos->rng_->rngs_);
                             ranges::set<N - 1>(pos->its_,
-                                ranges::next(ranges::begin(rng), ranges::end(rng)));
+                                detail::concat_segment_last(std::get<N - 1>(pos->rng_->rngs_)));
                             (*this)(ranges::get<N - 1>(pos->its_), meta::size_t<N - 1>{});
                         }
                         else
@@ -169,11 +202,9 @@ namespace ranges
                     template<typename Iterator, std::size_t N>
                     void operator()(Iterator &it, meta::size_t<N> which) const
                     {
-                        auto end = ranges::end(std::get<N>(pos->rng_->rngs_));
-                        // BUGBUG If distance(it, end) > n, then using bounded advance
-                        // is O(n) when it need not be since the end iterator position
-                        // is actually not interesting. Only the "rest" is needed, which
-                        // can sometimes be O(1).
+                        // For sized segments the bound is an iterator, so this is O(1)
+                        // regardless of the segment's sentinel type.
+                        auto end = detail::concat_segment_bound(std::get<N>(pos->rng_->rngs_));
                         auto rest = ranges::advance(it, n, std::move(end));
                         pos->satisfy(which);
                         if(rest != 0)
@@ -195,9 +226,8 @@ namespace ranges
                         auto begin = ranges::begin(std::get<N>(pos->rng_->rngs_));
                         if(it == begin)
                         {
-                            auto &&rng = std::get<N - 1>(pos->rng_->rngs_);
                             ranges::set<N - 1>(pos->its_,
-                                ranges::next(ranges::begin(rng), ranges::end(rng)));
+                                detail::concat_segment_last(std::get<N - 1>(pos->rng_->rngs_)));
                             (*this)(ranges::get<N - 1>(pos->its_), meta::size_t<N - 1>{});
                         }
                         else
@@ -221,11 +251,8 @@ namespace ranges
                     {
                         if(to.its_.which() == N)
                             return distance(ranges::get<N>(from.its_), ranges::get<N>(to.its_));
-#ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
-                        return distance(ranges::get<N>(from.its_), ranges::end(std::get<N>(from.rng_->rngs_))) +
-#else
-                        return distance(ranges::get<N>(from.its_), end(std::get<N>(from.rng_->rngs_))) +
-#endif
+                        return distance(ranges::get<N>(from.its_),
+                                detail::concat_segment_bound(std::get<N>(from.rng_->rngs_))) +
                             cursor::distance_to_(meta::size_t<N + 1>{}, from, to);
                     }
                     if(from.its_.which() < N && to.its_.which() > N)
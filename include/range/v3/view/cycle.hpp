@@ -72,6 +72,20 @@ namespace ranges
             {
                 ranges::get<end_tag>(*this).reset();
             }
+            void find_end_(std::true_type)
+            {}
+            void find_end_(std::false_type)
+            {
+                auto &end_ = ranges::get<end_tag>(*this);
+                if(!end_)
+                    end_ = ranges::next(ranges::begin(rng_), ranges::end(rng_));
+            }
+            // Iterating the view caches the end of the underlying range in it the
+            // first time the end is reached, so view::prepare finds it up front.
+            friend void prepare_view_(cycled_view &rng, int)
+            {
+                rng.find_end_(BoundedRange<Rng>());
+            }
 
             template<bool IsConst>
             struct cursor
@@ -0,0 +1,204 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_DISTINCT_HPP
+#define RANGES_V3_VIEW_DISTINCT_HPP
+
+#include <utility>
+#include <functional>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/for_each_while.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_set.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief The elements of a range whose keys, the elements themselves or their
+        /// projections, haven't been seen before, in the order they come.
+        ///
+        /// The keys seen so far are kept in a hash set in the view, which each call to
+        /// `begin()` empties, so this is a single-pass range. Integers, enumerations
+        /// and pointers hashed with `std::hash` go in a flat open-addressing set;
+        /// other keys, in a \c std::unordered_set.
+        template<typename Rng, typename P, typename H>
+        struct distinct_view
+          : view_facade<distinct_view<Rng, P, H>,
+                is_finite<Rng>::value ? finite : range_cardinality<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using key_t = iterator_value_t<Project<range_iterator_t<Rng>, P>>;
+            Rng rng_;
+            semiregular_t<function_type<P>> proj_;
+            detail::hash_set_<key_t, H> seen_;
+
+            bool insert(range_reference_t<Rng> ref)
+            {
+                return seen_.insert(proj_(ref));
+            }
+
+            struct cursor
+            {
+            private:
+                distinct_view *rng_;
+                range_iterator_t<Rng> it_;
+            public:
+                cursor() = default;
+                cursor(distinct_view &rng, range_iterator_t<Rng> it)
+                  : rng_(&rng), it_(std::move(it))
+                {
+                    satisfy();
+                }
+                void satisfy()
+                {
+                    auto const end = ranges::end(rng_->rng_);
+                    while(it_ != end && !rng_->insert(*it_))
+                        ++it_;
+                }
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    *it_
+                )
+                void next()
+                {
+                    ++it_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it_ == ranges::end(rng_->rng_);
+                }
+            };
+            cursor begin_cursor()
+            {
+                seen_.clear();
+                return {*this, ranges::begin(rng_)};
+            }
+
+            // Passes on the elements whose keys are new.
+            template<typename Sink>
+            struct sink
+            {
+                distinct_view &rng_;
+                Sink &sink_;
+                template<typename T>
+                auto operator()(T &&t) const ->
+                    decltype(sink_(static_cast<T &&>(t)))
+                {
+                    return !rng_.seen_.insert(rng_.proj_(t)) || sink_(static_cast<T &&>(t));
+                }
+            };
+            template<typename Sink>
+            auto for_each_while(Sink &s) ->
+                decltype(ranges::for_each_while(std::declval<Rng &>(), std::declval<sink<Sink>>()))
+            {
+                seen_.clear();
+                return ranges::for_each_while(rng_, sink<Sink>{*this, s});
+            }
+        public:
+            distinct_view() = default;
+            distinct_view(Rng rng, P proj, H hash)
+              : rng_(std::move(rng)), proj_(as_function(std::move(proj)))
+              , seen_(std::move(hash))
+            {}
+            Rng const &base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct distinct_fn
+            {
+            private:
+                friend view_access;
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                template<typename P, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(!Range<P>::value)>
+#else
+                template<typename P, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(!Range<P>())>
+#endif
+                static auto bind(distinct_fn distinct, P proj, H hash = H{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(distinct, std::placeholders::_1,
+                        protect(std::move(proj)), protect(std::move(hash))))
+                )
+            public:
+                template<typename Rng, typename P, typename H,
+                    typename I = range_iterator_t<Rng>,
+                    typename K = iterator_value_t<Project<I, P>>>
+                using Concept_ = meta::and_<
+                    EqualityComparable<K>,
+                    Function<function_type<H>, K const &>>;
+
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_>
+                using Concept = meta::and_<
+                    InputRange<Rng>,
+                    Projectable<range_iterator_t<Rng>, P>,
+                    meta::defer<Concept_, Rng, P, H>>;
+
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(Concept<Rng, P, H>::value)>
+                distinct_view<all_t<Rng>, P, H> operator()(Rng && rng, P proj = P{}, H hash = H{}) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(proj), std::move(hash)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident, typename H = detail::default_hash_,
+                    CONCEPT_REQUIRES_(!Concept<Rng, P, H>::value)>
+                void operator()(Rng &&, P = P{}, H = H{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The object on which view::distinct operates must be a model of the "
+                        "InputRange concept.");
+                    CONCEPT_ASSERT_MSG(Projectable<range_iterator_t<Rng>, P>(),
+                        "The projection function must accept objects of the iterator's value type, "
+                        "reference type, and rvalue reference type.");
+                    CONCEPT_ASSERT_MSG(Concept_<Rng, P, H>(),
+                        "The keys must be EqualityComparable, and the hash function must "
+                        "accept them.");
+                }
+            #endif
+            };
+
+            /// \relates distinct_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& distinct = static_const<view<distinct_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -77,6 +77,19 @@ namespace ranges
             {
                 return {*this, n_};
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<result_t>()))>
+            bool for_each_while(Sink &sink)
+            {
+                for(std::size_t n = n_; n != 0; --n)
+                {
+                    if(!sink(static_cast<result_t>(val_)))
+                        return false;
+                    if(n != 1)
+                        next();
+                }
+                return true;
+            }
         public:
             generate_n_view() = default;
             explicit generate_n_view(G g, std::size_t n)
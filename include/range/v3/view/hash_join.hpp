@@ -0,0 +1,304 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_HASH_JOIN_HPP
+#define RANGES_V3_VIEW_HASH_JOIN_HPP
+
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_set.hpp>
+#include <range/v3/utility/common_tuple.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief Asks \c view::hash_join for a left outer join, which keeps the
+        /// elements of the probe side that match nothing.
+        struct left_outer_t
+        {};
+
+        namespace
+        {
+            constexpr auto&& left_outer = static_const<left_outer_t>::value;
+        }
+
+        /// \brief The pairs of an element of the build range and an element of the
+        /// probe range whose keys are equal.
+        ///
+        /// The first time the view is iterated, it numbers the keys of the build
+        /// range in a hash table and sorts iterators to its elements by key, so the
+        /// matches of each key are contiguous and in the order they came. Then it
+        /// walks the probe range, looking up each key once and yielding a pair for
+        /// each of its matches. Pairs come in the order of the probe range, and the
+        /// probe range is walked as it is iterated, so it may be single-pass or
+        /// infinite; the build range must be a forward range, and should be the
+        /// smaller of the two.
+        ///
+        /// In a left outer join, a probe element that matches nothing is yielded once,
+        /// paired with a null pointer; the build elements of the other pairs are
+        /// pointers to them.
+        ///
+        /// The build range and its table are held by shared pointer, so copies of the
+        /// view are cheap, share one table, and don't invalidate the pairs. The table
+        /// is built once, under \c std::call_once, so copies can be iterated by several
+        /// threads at once.
+        template<typename Build, typename Probe, typename BK, typename PK, bool Outer>
+        struct hash_join_view
+          : view_facade<hash_join_view<Build, Probe, BK, PK, Outer>,
+                is_finite<Probe>::value ? finite :
+                    Outer ? range_cardinality<Probe>::value : unknown>
+        {
+        private:
+            friend range_access;
+            using key_t = iterator_value_t<Project<range_iterator_t<Build>, BK>>;
+            using build_ref_t = meta::if_c<Outer,
+                meta::_t<std::remove_reference<range_reference_t<Build>>> *,
+                range_reference_t<Build>>;
+            using build_value_t = meta::if_c<Outer, build_ref_t, range_value_t<Build>>;
+            static std::size_t npos()
+            {
+                return static_cast<std::size_t>(-1);
+            }
+
+            struct table
+            {
+                Build build_;
+                semiregular_t<function_type<BK>> build_key_;
+                detail::hash_index_<key_t, detail::default_hash_> index_;
+                // The matches of the key numbered g are matches_[offsets_[g], offsets_[g+1]).
+                std::vector<std::size_t> offsets_;
+                std::vector<range_iterator_t<Build>> matches_;
+                std::once_flag built_;
+
+                table(Build build, BK build_key)
+                  : build_(std::move(build)), build_key_(as_function(std::move(build_key)))
+                {}
+                std::size_t build_size(std::true_type) const
+                {
+                    return static_cast<std::size_t>(ranges::size(build_));
+                }
+                std::size_t build_size(std::false_type) const
+                {
+                    return 0;
+                }
+                void build()
+                {
+                    // Number the keys, and count the elements with each.
+                    std::vector<std::size_t> keys;
+                    std::size_t const n = build_size(SizedRange<Build>());
+                    keys.reserve(n);
+                    index_.reserve(n);
+                    offsets_.push_back(0);
+                    for(auto it = ranges::begin(build_), end = ranges::end(build_); it != end;
+                        ++it)
+                    {
+                        auto const res = index_.insert(build_key_(*it), offsets_.size() - 1);
+                        if(res.second)
+                            offsets_.push_back(0);
+                        ++offsets_[res.first + 1];
+                        keys.push_back(res.first);
+                    }
+                    for(std::size_t g = 1; g != offsets_.size(); ++g)
+                        offsets_[g] += offsets_[g - 1];
+
+                    // Place each element after the others with its key.
+                    std::vector<std::size_t> next(offsets_.begin(), offsets_.end() - 1);
+                    matches_.resize(keys.size());
+                    auto it = ranges::begin(build_);
+                    for(std::size_t key : keys)
+                        matches_[next[key]++] = it++;
+                }
+            };
+
+            std::shared_ptr<table> table_;
+            Probe probe_;
+            semiregular_t<function_type<PK>> probe_key_;
+
+            struct cursor
+            {
+            private:
+                hash_join_view *rng_;
+                table const *table_;
+                range_iterator_t<Probe> it_;
+                // The position of the current match in matches_, and the end of the
+                // probe element's matches; both npos for an unmatched element of a
+                // left outer join.
+                std::size_t pos_, end_;
+            public:
+                using value_type = std::pair<build_value_t, range_value_t<Probe>>;
+                using single_pass = SinglePass<range_iterator_t<Probe>>;
+                cursor() = default;
+                cursor(hash_join_view &rng, range_iterator_t<Probe> it)
+                  : rng_(&rng), table_(rng.table_.get()), it_(std::move(it)), pos_(0)
+                  , end_(0)
+                {
+                    satisfy();
+                }
+                void satisfy()
+                {
+                    auto const end = ranges::end(rng_->probe_);
+                    for(; it_ != end; ++it_)
+                    {
+                        std::size_t const key = table_->index_.find(rng_->probe_key_(*it_));
+                        if(key != npos())
+                        {
+                            pos_ = table_->offsets_[key];
+                            end_ = table_->offsets_[key + 1];
+                            return;
+                        }
+                        if(Outer)
+                        {
+                            pos_ = end_ = npos();
+                            return;
+                        }
+                    }
+                }
+                common_pair<build_ref_t, range_reference_t<Probe>> current() const
+                {
+                    return {match(meta::bool_<Outer>{}), *it_};
+                }
+                range_reference_t<Build> match(std::false_type) const
+                {
+                    return *table_->matches_[pos_];
+                }
+                build_ref_t match(std::true_type) const
+                {
+                    return pos_ == npos() ? nullptr : &*table_->matches_[pos_];
+                }
+                void next()
+                {
+                    if(pos_ != npos() && ++pos_ != end_)
+                        return;
+                    ++it_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it_ == ranges::end(rng_->probe_);
+                }
+                CONCEPT_REQUIRES(ForwardRange<Probe>::value)
+                bool equal(cursor const &that) const
+                {
+                    return it_ == that.it_ && pos_ == that.pos_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                table &t = *table_;
+                std::call_once(t.built_, [&t] { t.build(); });
+                return {*this, ranges::begin(probe_)};
+            }
+        public:
+            hash_join_view() = default;
+            hash_join_view(Build build, Probe probe, BK build_key, PK probe_key)
+              : table_(std::make_shared<table>(std::move(build), std::move(build_key)))
+              , probe_(std::move(probe)), probe_key_(as_function(std::move(probe_key)))
+            {}
+        };
+
+        namespace view
+        {
+            struct hash_join_fn
+            {
+                template<typename Build, typename Probe, typename BK, typename PK,
+                    typename K = iterator_value_t<Project<range_iterator_t<Build>, BK>>,
+                    typename PV = iterator_value_t<Project<range_iterator_t<Probe>, PK>>>
+                using Concept_ = meta::and_<
+                    EqualityComparable<K>,
+                    CopyConstructible<K>,
+                    ConvertibleTo<PV, K>>;
+
+                template<typename Build, typename Probe, typename BK, typename PK>
+                using Concept = meta::and_<
+                    ForwardRange<Build>,
+                    InputRange<Probe>,
+                    Projectable<range_iterator_t<Build>, BK>,
+                    Projectable<range_iterator_t<Probe>, PK>,
+                    meta::defer<Concept_, Build, Probe, BK, PK>>;
+
+                template<typename Build, typename Probe, typename BK, typename PK,
+                    CONCEPT_REQUIRES_(Concept<Build, Probe, BK, PK>::value)>
+                hash_join_view<all_t<Build>, all_t<Probe>, BK, PK, false>
+                operator()(Build && build, Probe && probe, BK build_key, PK probe_key) const
+                {
+                    return {all(std::forward<Build>(build)), all(std::forward<Probe>(probe)),
+                        std::move(build_key), std::move(probe_key)};
+                }
+                template<typename Build, typename Probe, typename BK, typename PK,
+                    CONCEPT_REQUIRES_(Concept<Build, Probe, BK, PK>::value &&
+                        std::is_lvalue_reference<range_reference_t<Build>>::value)>
+                hash_join_view<all_t<Build>, all_t<Probe>, BK, PK, true>
+                operator()(Build && build, Probe && probe, BK build_key, PK probe_key,
+                    left_outer_t) const
+                {
+                    return {all(std::forward<Build>(build)), all(std::forward<Probe>(probe)),
+                        std::move(build_key), std::move(probe_key)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Build, typename Probe, typename BK, typename PK,
+                    typename...Kind,
+                    CONCEPT_REQUIRES_(!Concept<Build, Probe, BK, PK>::value)>
+                void operator()(Build &&, Probe &&, BK, PK, Kind...) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Build>(),
+                        "The range that view::hash_join builds its hash table from, the first "
+                        "argument, must be a model of the ForwardRange concept.");
+                    CONCEPT_ASSERT_MSG(InputRange<Probe>(),
+                        "The range that view::hash_join probes the hash table with, the second "
+                        "argument, must be a model of the InputRange concept.");
+                    CONCEPT_ASSERT_MSG(Projectable<range_iterator_t<Build>, BK>(),
+                        "The key function of the build range must accept objects of its "
+                        "iterator's value type, reference type, and rvalue reference type.");
+                    CONCEPT_ASSERT_MSG(Projectable<range_iterator_t<Probe>, PK>(),
+                        "The key function of the probe range must accept objects of its "
+                        "iterator's value type, reference type, and rvalue reference type.");
+                    CONCEPT_ASSERT_MSG(Concept_<Build, Probe, BK, PK>(),
+                        "The keys of the build range must be EqualityComparable and "
+                        "CopyConstructible, and the keys of the probe range must be "
+                        "convertible to them.");
+                }
+            #endif
+            };
+
+            /// \relates hash_join_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& hash_join = static_const<hash_join_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
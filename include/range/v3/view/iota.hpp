@@ -220,6 +220,20 @@ namespace ranges
             {
                 return detail::iota_minus(that.from_, from_);
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<From>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                if(done_)
+                    return true;
+                for(From i = from_;; ++i)
+                {
+                    if(!sink(static_cast<From>(i)))
+                        return false;
+                    if(i == to_)
+                        return true;
+                }
+            }
         public:
             closed_iota_view() = default;
             constexpr closed_iota_view(From from, To to)
@@ -287,6 +301,15 @@ namespace ranges
             {
                 return detail::iota_minus(that.from_, from_);
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<From>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                for(From i = from_; i != to_; ++i)
+                    if(!sink(static_cast<From>(i)))
+                        return false;
+                return true;
+            }
         public:
             iota_view() = default;
             constexpr iota_view(From from, To to)
@@ -353,6 +376,14 @@ namespace ranges
             {
                 return detail::iota_minus(that.value_, value_);
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<From>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                for(From i = value_;; ++i)
+                    if(!sink(static_cast<From>(i)))
+                        return false;
+            }
         public:
             iota_view() = default;
             constexpr explicit iota_view(From value)
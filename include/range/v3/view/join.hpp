@@ -14,7 +14,10 @@
 #ifndef RANGES_V3_VIEW_JOIN_HPP
 #define RANGES_V3_VIEW_JOIN_HPP
 
+#include <memory>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
@@ -22,7 +25,9 @@
 #include <range/v3/numeric.hpp> // for accumulate
 #include <range/v3/begin_end.hpp>
 #include <range/v3/empty.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/view_adaptor.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -49,6 +54,89 @@ namespace ranges
                             Outer::value == finite || Inner::value == finite || (Joiner::value == finite && Outer::value != 0 && Outer::value != 1) ?
                                 finite :
                                 static_cast<cardinality>(Outer::value * Inner::value + (Outer::value == 0 ? 0 : (Outer::value - 1) * Joiner::value))>;
+
+            template<typename Rng>
+            using join_inner_t = meta::_t<std::remove_reference<range_reference_t<Rng>>>;
+
+            // A forward range of lvalue forward ranges can be joined without caching
+            // the current inner range in the view, which makes the join multipass.
+            template<typename Rng>
+            using MultipassJoinable = meta::and_<
+                ForwardRange<Rng>,
+                std::is_lvalue_reference<range_reference_t<Rng>>,
+                ForwardRange<join_inner_t<Rng>>>;
+
+            template<typename Rng>
+            using BidirectionalJoinable = meta::and_<
+                MultipassJoinable<Rng>,
+                BidirectionalRange<Rng>,
+                BoundedRange<Rng>,
+                BidirectionalRange<join_inner_t<Rng>>,
+                BoundedRange<join_inner_t<Rng>>>;
+
+            // Random access is provided through a table of the offsets at which each
+            // inner range starts.
+            template<typename Rng>
+            using RandomAccessJoinable = meta::and_<
+                BidirectionalJoinable<Rng>,
+                RandomAccessRange<Rng>,
+                SizedRange<Rng>,
+                RandomAccessRange<join_inner_t<Rng>>,
+                SizedRange<join_inner_t<Rng>>>;
+
+            // The table of offsets of a random-access join, built by the first operation
+            // that needs it and then never written. Threads that race to build it each
+            // build one, and all use the one published first. Copies share it once it
+            // is built.
+            template<typename D>
+            struct join_offsets_
+            {
+            private:
+                std::shared_ptr<std::vector<D> const> table_;
+            public:
+                join_offsets_() = default;
+                join_offsets_(join_offsets_ const &that)
+                  : table_(std::atomic_load(&that.table_))
+                {}
+                join_offsets_ &operator=(join_offsets_ const &that)
+                {
+                    std::atomic_store(&table_, std::atomic_load(&that.table_));
+                    return *this;
+                }
+                template<typename Rng>
+                std::vector<D> const &get(Rng &rng)
+                {
+                    auto table = std::atomic_load(&table_);
+                    if(!table)
+                    {
+                        auto offs = std::make_shared<std::vector<D>>();
+                        offs->reserve(static_cast<std::size_t>(ranges::size(rng)) + 1u);
+                        D n = 0;
+                        offs->push_back(n);
+                        for(auto &&inner : rng)
+                            offs->push_back(n += ranges::distance(inner));
+                        decltype(table) expected;
+                        table = std::move(offs);
+                        if(!std::atomic_compare_exchange_strong(&table_, &expected, table))
+                            table = std::move(expected);
+                    }
+                    // table_ holds it for as long as the view lives.
+                    return *table;
+                }
+            };
+
+            // Pushes the elements of each inner range to the sink in turn.
+            template<typename Sink>
+            struct join_sink
+            {
+                Sink &sink_;
+                template<typename Inner>
+                auto operator()(Inner &&inner) const ->
+                    decltype(ranges::for_each_while(inner, sink_))
+                {
+                    return ranges::for_each_while(inner, sink_);
+                }
+            };
         }
         /// \endcond
 
@@ -72,9 +160,167 @@ namespace ranges
             CONCEPT_ASSERT(Range<range_value_t<Rng>>());
 #endif
             using size_t_ = common_type_t<range_size_t<Rng>, range_size_t<range_value_t<Rng>>>;
+            using inner_t = detail::join_inner_t<Rng>;
+
+            using difference_t_ = common_type_t<range_difference_t<Rng>, range_difference_t<inner_t>>;
+            // Whether the size of every inner range is a compile-time constant, in
+            // which case random access needs no table of offsets.
+            using fixed_inner_t = meta::bool_<(range_cardinality<inner_t>::value >= 0)>;
 
             friend range_access;
             view::all_t<range_value_t<Rng>> cur_;
+            // offsets()[i] is the position in the joined range at which the i-th inner
+            // range begins, and the last element is the size of the joined range. It is
+            // only used by random-access joins of variably-sized inner ranges. It is
+            // built by the first operation that needs it, so the inner ranges must not
+            // change size after that, and it can be built and read by several threads
+            // at once.
+            meta::if_<
+                meta::and_<detail::RandomAccessJoinable<Rng>, meta::not_<fixed_inner_t>>,
+                detail::join_offsets_<difference_t_>,
+                meta::nil_> offsets_;
+
+            std::vector<difference_t_> const &offsets()
+            {
+                return offsets_.get(this->mutable_base());
+            }
+            // The position at which the i-th inner range begins.
+            difference_t_ offset_(difference_t_ i, std::true_type)
+            {
+                return i * static_cast<difference_t_>(range_cardinality<inner_t>::value);
+            }
+            difference_t_ offset_(difference_t_ i, std::false_type)
+            {
+                return offsets()[static_cast<std::size_t>(i)];
+            }
+            // The index of the inner range containing the position idx, which must be
+            // less than the size of the joined range.
+            difference_t_ segment_(difference_t_ idx, std::true_type)
+            {
+                return idx / static_cast<difference_t_>(range_cardinality<inner_t>::value);
+            }
+            difference_t_ segment_(difference_t_ idx, std::false_type)
+            {
+                // The last inner range starting at or before idx is the non-empty one
+                // that contains it.
+                auto const &offs = offsets();
+                return (std::upper_bound(offs.begin(), offs.end(), idx) - offs.begin()) - 1;
+            }
+
+            // Iterates a range of lvalue ranges in place: the position is the outer
+            // iterator and an iterator into the inner range it refers to. At the end,
+            // the inner iterator is value-initialized.
+            struct multipass_adaptor : adaptor_base
+            {
+            private:
+                join_view *rng_;
+                range_iterator_t<inner_t> it_;
+                void satisfy(range_iterator_t<Rng> &it)
+                {
+                    auto const end = ranges::end(rng_->mutable_base());
+                    while(it_ == ranges::end(*it))
+                    {
+                        if(++it == end)
+                        {
+                            it_ = detail::value_init{};
+                            break;
+                        }
+                        it_ = ranges::begin(*it);
+                    }
+                }
+                // The position of this iterator in the joined range.
+                difference_t_ index_(range_iterator_t<Rng> const &it) const
+                {
+                    auto &base = rng_->mutable_base();
+                    auto const i = it - ranges::begin(base);
+                    return rng_->offset_(i, fixed_inner_t{}) +
+                        (it == ranges::end(base) ? 0 : it_ - ranges::begin(*it));
+                }
+            public:
+                multipass_adaptor() = default;
+                multipass_adaptor(join_view &rng)
+                  : rng_(&rng), it_{}
+                {}
+                range_iterator_t<Rng> begin(join_view &)
+                {
+                    auto it = ranges::begin(rng_->mutable_base());
+                    if(it != ranges::end(rng_->mutable_base()))
+                    {
+                        it_ = ranges::begin(*it);
+                        satisfy(it);
+                    }
+                    return it;
+                }
+                bool equal(range_iterator_t<Rng> const &it, range_iterator_t<Rng> const &other_it,
+                    multipass_adaptor const &other_adapt) const
+                {
+                    return it == other_it && it_ == other_adapt.it_;
+                }
+                void next(range_iterator_t<Rng> &it)
+                {
+                    ++it_;
+                    satisfy(it);
+                }
+                CONCEPT_REQUIRES(detail::BidirectionalJoinable<Rng>::value)
+                void prev(range_iterator_t<Rng> &it)
+                {
+                    while(it == ranges::end(rng_->mutable_base()) || it_ == ranges::begin(*it))
+                    {
+                        --it;
+                        it_ = ranges::end(*it);
+                    }
+                    --it_;
+                }
+                CONCEPT_REQUIRES(detail::RandomAccessJoinable<Rng>::value)
+                void advance(range_iterator_t<Rng> &it, range_difference_t<Rng> n)
+                {
+                    auto &base = rng_->mutable_base();
+                    // Stay within the current inner range if we can.
+                    if(it != ranges::end(base))
+                    {
+                        difference_t_ const pos = (it_ - ranges::begin(*it)) + n;
+                        if(0 <= pos && pos < ranges::distance(*it))
+                        {
+                            it_ += n;
+                            return;
+                        }
+                    }
+                    auto const outer = ranges::distance(base);
+                    auto const size = rng_->offset_(outer, fixed_inner_t{});
+                    auto const idx = index_(it) + n;
+                    RANGES_ASSERT(0 <= idx && idx <= size);
+                    if(idx == size)
+                    {
+                        it = ranges::begin(base) + outer;
+                        it_ = detail::value_init{};
+                        return;
+                    }
+                    auto const seg = rng_->segment_(idx, fixed_inner_t{});
+                    it = ranges::begin(base) + static_cast<range_difference_t<Rng>>(seg);
+                    it_ = ranges::begin(*it) +
+                        static_cast<range_difference_t<inner_t>>(idx - rng_->offset_(seg, fixed_inner_t{}));
+                }
+                CONCEPT_REQUIRES(detail::RandomAccessJoinable<Rng>::value)
+                range_difference_t<Rng>
+                distance_to(range_iterator_t<Rng> const &it, range_iterator_t<Rng> const &other_it,
+                    multipass_adaptor const &other_adapt) const
+                {
+                    if(it == other_it && it != ranges::end(rng_->mutable_base()))
+                        return static_cast<range_difference_t<Rng>>(other_adapt.it_ - it_);
+                    return static_cast<range_difference_t<Rng>>(
+                        other_adapt.index_(other_it) - index_(it));
+                }
+                auto current(range_iterator_t<Rng> const &) const ->
+                    decltype(*it_)
+                {
+                    return *it_;
+                }
+                auto indirect_move(range_iterator_t<Rng> const &) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    ranges::indirect_move(it_)
+                )
+            };
 
             struct adaptor : adaptor_base
             {
@@ -138,14 +384,33 @@ namespace ranges
                 )
                 void distance_to() = delete;
             };
+            CONCEPT_REQUIRES(!detail::MultipassJoinable<Rng>::value)
             adaptor begin_adaptor()
             {
                 return {*this};
             }
+            CONCEPT_REQUIRES(!detail::MultipassJoinable<Rng>::value)
             adaptor end_adaptor()
             {
                 return {};
             }
+            CONCEPT_REQUIRES(detail::MultipassJoinable<Rng>::value)
+            multipass_adaptor begin_adaptor()
+            {
+                return {*this};
+            }
+            CONCEPT_REQUIRES(detail::MultipassJoinable<Rng>::value)
+            multipass_adaptor end_adaptor()
+            {
+                return {*this};
+            }
+            // A loop over the inner ranges nested in a loop over the outer range.
+            template<typename Sink>
+            auto for_each_while(Sink &sink) ->
+                decltype(ranges::for_each_while(std::declval<Rng &>(), detail::join_sink<Sink>{sink}))
+            {
+                return ranges::for_each_while(this->mutable_base(), detail::join_sink<Sink>{sink});
+            }
             // TODO: could support const iteration if range_reference_t<Rng> is a true reference.
         public:
             join_view() = default;
@@ -168,6 +433,13 @@ namespace ranges
                     (size_t_)range_cardinality<join_view>::value :
                     accumulate(view::transform(this->base(), ranges::size), size_t_{0});
             }
+            /// Linear in the size of the outer range.
+            CONCEPT_REQUIRES(range_cardinality<Rng>::value < 0 &&
+                detail::MultipassJoinable<Rng>::value && SizedRange<inner_t>::value)
+            size_t_ size() const
+            {
+                return accumulate(view::transform(this->mutable_base(), ranges::size), size_t_{0});
+            }
         };
 
         // Join a range of ranges, inserting a range of values between them.
@@ -0,0 +1,272 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MAPPED_FILE_HPP
+#define RANGES_V3_VIEW_MAPPED_FILE_HPP
+
+#include <string>
+#include <memory>
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/view_interface.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// How a mapped file is going to be read. These are passed on to the
+        /// operating system (`madvise` on POSIX) and have no effect where it has
+        /// nothing equivalent.
+        enum class mapped_file_hint
+        {
+            normal,
+            sequential, ///< Read ahead aggressively and drop pages once they're read.
+            random,     ///< Don't read ahead.
+            willneed,   ///< Start reading the whole file in now.
+            huge_pages  ///< Back the mapping with huge pages if the system can.
+        };
+
+        /// \cond
+        namespace detail
+        {
+            // Owns a read-only mapping of a whole file.
+            struct file_mapping
+            {
+            private:
+                void *data_;
+                std::size_t size_;
+#ifdef _WIN32
+                HANDLE file_, mapping_;
+#endif
+
+                [[noreturn]] static void fail(char const *what)
+                {
+#ifdef _WIN32
+                    throw std::system_error(static_cast<int>(::GetLastError()),
+                        std::system_category(), what);
+#else
+                    throw std::system_error(errno, std::system_category(), what);
+#endif
+                }
+            public:
+                explicit file_mapping(std::string const &path)
+                  : data_(nullptr), size_(0)
+                {
+#ifdef _WIN32
+                    file_ = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                    if(INVALID_HANDLE_VALUE == file_)
+                        fail("CreateFile");
+                    mapping_ = nullptr;
+                    LARGE_INTEGER size;
+                    if(!::GetFileSizeEx(file_, &size))
+                    {
+                        ::CloseHandle(file_);
+                        fail("GetFileSizeEx");
+                    }
+                    size_ = static_cast<std::size_t>(size.QuadPart);
+                    if(0 == size_)
+                        return;
+                    mapping_ = ::CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if(nullptr == mapping_ ||
+                        nullptr == (data_ = ::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)))
+                    {
+                        if(mapping_)
+                            ::CloseHandle(mapping_);
+                        ::CloseHandle(file_);
+                        fail("MapViewOfFile");
+                    }
+#else
+                    int fd = ::open(path.c_str(), O_RDONLY);
+                    if(-1 == fd)
+                        fail("open");
+                    struct stat st;
+                    if(-1 == ::fstat(fd, &st))
+                    {
+                        ::close(fd);
+                        fail("fstat");
+                    }
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    if(0 != size_)
+                    {
+                        data_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                        if(MAP_FAILED == data_)
+                        {
+                            data_ = nullptr;
+                            ::close(fd);
+                            fail("mmap");
+                        }
+                    }
+                    // The mapping keeps the file alive.
+                    ::close(fd);
+#endif
+                }
+                file_mapping(file_mapping const &) = delete;
+                file_mapping &operator=(file_mapping const &) = delete;
+                ~file_mapping()
+                {
+#ifdef _WIN32
+                    if(data_)
+                        ::UnmapViewOfFile(data_);
+                    if(mapping_)
+                        ::CloseHandle(mapping_);
+                    ::CloseHandle(file_);
+#else
+                    if(data_)
+                        ::munmap(data_, size_);
+#endif
+                }
+                void const *data() const
+                {
+                    return data_;
+                }
+                std::size_t size() const
+                {
+                    return size_;
+                }
+                void advise(mapped_file_hint hint) const
+                {
+                    if(!data_)
+                        return;
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+                    if(mapped_file_hint::willneed == hint)
+                    {
+                        WIN32_MEMORY_RANGE_ENTRY entry{data_, size_};
+                        (void) ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &entry, 0);
+                    }
+#else
+                    (void) hint;
+#endif
+#else
+                    int advice = POSIX_MADV_NORMAL;
+                    switch(hint)
+                    {
+                    case mapped_file_hint::sequential:
+                        advice = POSIX_MADV_SEQUENTIAL;
+                        break;
+                    case mapped_file_hint::random:
+                        advice = POSIX_MADV_RANDOM;
+                        break;
+                    case mapped_file_hint::willneed:
+                        advice = POSIX_MADV_WILLNEED;
+                        break;
+                    case mapped_file_hint::huge_pages:
+#ifdef MADV_HUGEPAGE
+                        (void) ::madvise(data_, size_, MADV_HUGEPAGE);
+#endif
+                        return;
+                    case mapped_file_hint::normal:
+                        break;
+                    }
+                    // Advice is only advice; ignore failures.
+                    (void) ::posix_madvise(data_, size_, advice);
+#endif
+                }
+            };
+        }
+        /// \endcond
+
+        /// \brief The contents of a file, mapped into memory, as a contiguous range
+        /// of \c T.
+        ///
+        /// The file is mapped read-only, so the elements are `T const`. A trailing
+        /// partial record, if the file's size isn't a multiple of `sizeof(T)`, is not
+        /// part of the range. Copies of the view share the mapping, which is released
+        /// when the last of them goes away. Throws `std::system_error` if the file
+        /// can't be opened or mapped.
+        template<typename T>
+        struct mapped_file_view
+          : view_interface<mapped_file_view<T>>
+        {
+        private:
+            static_assert(std::is_pod<T>::value,
+                "Only files of plain-old-data records can be mapped into memory.");
+            std::shared_ptr<detail::file_mapping const> map_;
+            T const *begin_, *end_;
+        public:
+            using iterator = T const *;
+
+            mapped_file_view()
+              : map_{}, begin_(nullptr), end_(nullptr)
+            {}
+            explicit mapped_file_view(std::string const &path,
+                mapped_file_hint hint = mapped_file_hint::normal)
+              : map_(std::make_shared<detail::file_mapping>(path))
+              , begin_(static_cast<T const *>(map_->data()))
+              , end_(begin_ + map_->size() / sizeof(T))
+            {
+                advise(hint);
+            }
+            iterator begin() const
+            {
+                return begin_;
+            }
+            iterator end() const
+            {
+                return end_;
+            }
+            T const *data() const
+            {
+                return begin_;
+            }
+            std::size_t size() const
+            {
+                return static_cast<std::size_t>(end_ - begin_);
+            }
+            /// Tells the operating system how the file is going to be read from now
+            /// on. Can be called again between phases that read it differently.
+            void advise(mapped_file_hint hint) const
+            {
+                if(map_)
+                    map_->advise(hint);
+            }
+        };
+
+        namespace view
+        {
+            /// \relates mapped_file_view
+            /// TODO use a variable template here when they're available
+            template<typename T = char>
+            mapped_file_view<T> mapped_file(std::string const &path,
+                mapped_file_hint hint = mapped_file_hint::normal)
+            {
+                return mapped_file_view<T>{path, hint};
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
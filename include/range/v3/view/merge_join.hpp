@@ -0,0 +1,202 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MERGE_JOIN_HPP
+#define RANGES_V3_VIEW_MERGE_JOIN_HPP
+
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief For each key found in both of two sorted ranges, the pair of the runs
+        /// of elements with that key in each, in order of their keys.
+        ///
+        /// The ranges are walked together, as \c set_intersection walks them, and a
+        /// run ends at the first element whose key is not equivalent to the key of the
+        /// other range's run, so each element is compared a constant number of times
+        /// and nothing is copied or allocated. The runs are subranges of the two
+        /// ranges; to pair up their elements, join their cross product, as with
+        /// \c view::for_each.
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        struct merge_join_view
+          : view_facade<merge_join_view<Rng1, Rng2, C, P1, P2>,
+                is_finite<Rng1>::value || is_finite<Rng2>::value ? finite : unknown>
+        {
+        private:
+            friend range_access;
+            Rng1 rng1_;
+            Rng2 rng2_;
+            semiregular_t<function_type<C>> pred_;
+            semiregular_t<function_type<P1>> proj1_;
+            semiregular_t<function_type<P2>> proj2_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using view_t = meta::apply<meta::add_const_if_c<IsConst>, merge_join_view>;
+                using I1 = range_iterator_t<meta::apply<meta::add_const_if_c<IsConst>, Rng1>>;
+                using I2 = range_iterator_t<meta::apply<meta::add_const_if_c<IsConst>, Rng2>>;
+                view_t *rng_;
+                // The runs of the current key are [it1_, end1_) and [it2_, end2_).
+                I1 it1_, end1_;
+                I2 it2_, end2_;
+
+                bool less1(I1 const &i1, I2 const &i2) const
+                {
+                    return rng_->pred_(rng_->proj1_(*i1), rng_->proj2_(*i2));
+                }
+                bool less2(I2 const &i2, I1 const &i1) const
+                {
+                    return rng_->pred_(rng_->proj2_(*i2), rng_->proj1_(*i1));
+                }
+                void satisfy()
+                {
+                    auto const last1 = ranges::end(rng_->rng1_);
+                    auto const last2 = ranges::end(rng_->rng2_);
+                    while(it1_ != last1 && it2_ != last2)
+                    {
+                        if(less1(it1_, it2_))
+                            ++it1_;
+                        else if(less2(it2_, it1_))
+                            ++it2_;
+                        else
+                        {
+                            end1_ = ranges::next(it1_);
+                            while(end1_ != last1 && !less2(it2_, end1_))
+                                ++end1_;
+                            end2_ = ranges::next(it2_);
+                            while(end2_ != last2 && !less1(it1_, end2_))
+                                ++end2_;
+                            return;
+                        }
+                    }
+                }
+            public:
+                using single_pass = std::false_type;
+                cursor() = default;
+                cursor(view_t &rng)
+                  : rng_(&rng), it1_(ranges::begin(rng.rng1_)), end1_(it1_)
+                  , it2_(ranges::begin(rng.rng2_)), end2_(it2_)
+                {
+                    satisfy();
+                }
+                std::pair<range<I1>, range<I2>> current() const
+                {
+                    return {{it1_, end1_}, {it2_, end2_}};
+                }
+                void next()
+                {
+                    it1_ = end1_;
+                    it2_ = end2_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it1_ == ranges::end(rng_->rng1_) || it2_ == ranges::end(rng_->rng2_);
+                }
+                bool equal(cursor const &that) const
+                {
+                    return it1_ == that.it1_ && it2_ == that.it2_;
+                }
+            };
+            cursor<false> begin_cursor()
+            {
+                return {*this};
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(Range<Rng1 const>::value && Range<Rng2 const>::value)
+#else
+            CONCEPT_REQUIRES(Range<Rng1 const>() && Range<Rng2 const>())
+#endif
+            cursor<true> begin_cursor() const
+            {
+                return {*this};
+            }
+        public:
+            merge_join_view() = default;
+            merge_join_view(Rng1 rng1, Rng2 rng2, C pred, P1 proj1, P2 proj2)
+              : rng1_(std::move(rng1)), rng2_(std::move(rng2))
+              , pred_(as_function(std::move(pred)))
+              , proj1_(as_function(std::move(proj1)))
+              , proj2_(as_function(std::move(proj2)))
+            {}
+        };
+
+        namespace view
+        {
+            struct merge_join_fn
+            {
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident>
+                using Concept = meta::and_<
+                    ForwardRange<Rng1>,
+                    ForwardRange<Rng2>,
+                    Comparable<range_iterator_t<Rng1>, range_iterator_t<Rng2>, C, P1, P2>>;
+
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, C, P1, P2>::value)>
+                merge_join_view<all_t<Rng1>, all_t<Rng2>, C, P1, P2>
+                operator()(Rng1 && rng1, Rng2 && rng2, C pred = C{}, P1 proj1 = P1{},
+                    P2 proj2 = P2{}) const
+                {
+                    return {all(std::forward<Rng1>(rng1)), all(std::forward<Rng2>(rng2)),
+                        std::move(pred), std::move(proj1), std::move(proj2)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>::value)>
+                void operator()(Rng1 &&, Rng2 &&, C = C{}, P1 = P1{}, P2 = P2{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng1>() && ForwardRange<Rng2>(),
+                        "The ranges view::merge_join joins must be models of the ForwardRange "
+                        "concept, so that their runs of equal keys can be views of them.");
+                    CONCEPT_ASSERT_MSG(Comparable<range_iterator_t<Rng1>, range_iterator_t<Rng2>,
+                        C, P1, P2>(),
+                        "The predicate must order the projected elements of either range "
+                        "against those of the other.");
+                }
+            #endif
+            };
+
+            /// \relates merge_join_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& merge_join = static_const<merge_join_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,321 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PARSE_HPP
+#define RANGES_V3_VIEW_PARSE_HPP
+
+#include <cerrno>
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/view_facade.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            [[noreturn]] inline void parse_error_(char const *first, char const *last)
+            {
+                throw std::invalid_argument(
+                    "ranges::view::parse: not a number: " + std::string(first, last));
+            }
+
+            [[noreturn]] inline void parse_overflow_(char const *first, char const *last)
+            {
+                throw std::out_of_range(
+                    "ranges::view::parse: out of range: " + std::string(first, last));
+            }
+
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_integral<T>::value)>
+            T parse_number_(char const *first, char const *last)
+            {
+                using U = meta::_t<std::make_unsigned<T>>;
+                char const *const token = first;
+                bool const neg = first != last && '-' == *first;
+                if(first != last && ('-' == *first || '+' == *first))
+                    ++first;
+                if(first == last || (neg && std::is_unsigned<T>::value))
+                    parse_error_(token, last);
+                U const max = static_cast<U>(std::numeric_limits<T>::max()) + (neg ? 1u : 0u);
+                U u = 0;
+                for(; first != last; ++first)
+                {
+                    unsigned const d = static_cast<unsigned>(*first - '0');
+                    if(d > 9)
+                        parse_error_(token, last);
+                    if(u > max / 10 || (u == max / 10 && d > max % 10))
+                        parse_overflow_(token, last);
+                    u = static_cast<U>(u * 10 + d);
+                }
+                return neg ? static_cast<T>(0 - u) : static_cast<T>(u);
+            }
+
+            inline float parse_strto_(char const *str, char **end, float *)
+            {
+                return std::strtof(str, end);
+            }
+            inline double parse_strto_(char const *str, char **end, double *)
+            {
+                return std::strtod(str, end);
+            }
+            inline long double parse_strto_(char const *str, char **end, long double *)
+            {
+                return std::strtold(str, end);
+            }
+
+            template<typename T>
+            T parse_float_slow_(char const *first, char const *last)
+            {
+                char buf[64];
+                std::string str;
+                char const *cstr = buf;
+                std::size_t const len = static_cast<std::size_t>(last - first);
+                if(len < sizeof(buf))
+                {
+                    std::copy(first, last, buf);
+                    buf[len] = '\0';
+                }
+                else
+                    cstr = (str.assign(first, last)).c_str();
+                char *end = nullptr;
+                errno = 0;
+                T const d = parse_strto_(cstr, &end, static_cast<T *>(nullptr));
+                if(end != cstr + len)
+                    parse_error_(first, last);
+                // Too big for T, rather than an infinity written as such.
+                if(ERANGE == errno && (d > std::numeric_limits<T>::max() ||
+                        d < -std::numeric_limits<T>::max()))
+                    parse_overflow_(first, last);
+                return d;
+            }
+
+            // Numbers whose significant digits and power of ten are both exact in T
+            // are parsed with a single multiplication or division in T, which is
+            // correctly rounded. That is up to 2^53 and 10^22 for double, and 2^24
+            // and 10^10 for float. Anything else (long mantissas, large exponents,
+            // inf, nan, hex floats) goes to strtof, strtod or strtold.
+            template<typename T,
+                CONCEPT_REQUIRES_(std::is_floating_point<T>::value)>
+            T parse_number_(char const *first, char const *last)
+            {
+                static double const pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+                    1e21, 1e22};
+                char const *const token = first;
+                bool const neg = first != last && '-' == *first;
+                if(first != last && ('-' == *first || '+' == *first))
+                    ++first;
+                // m holds the first 19 significant digits, and exp the power of ten
+                // to scale them by. digits counts all the significant digits seen.
+                std::uint64_t m = 0;
+                int digits = 0, exp = 0;
+                bool any = false;
+                auto digit = [&](bool fraction)
+                {
+                    any = true;
+                    if(digits < 19)
+                    {
+                        m = m * 10 + static_cast<unsigned>(*first - '0');
+                        digits += 0 != m;
+                        exp -= fraction;
+                    }
+                    else
+                    {
+                        exp += !fraction;
+                        ++digits;
+                    }
+                };
+                for(; first != last && static_cast<unsigned>(*first - '0') <= 9; ++first)
+                    digit(false);
+                if(first != last && '.' == *first)
+                {
+                    for(++first; first != last && static_cast<unsigned>(*first - '0') <= 9; ++first)
+                        digit(true);
+                }
+                if(any && first != last && ('e' == *first || 'E' == *first))
+                {
+                    char const *e = first + 1;
+                    bool const eneg = e != last && '-' == *e;
+                    if(e != last && ('-' == *e || '+' == *e))
+                        ++e;
+                    int x = 0;
+                    if(e == last || static_cast<unsigned>(*e - '0') > 9)
+                        parse_error_(token, last);
+                    for(; e != last && static_cast<unsigned>(*e - '0') <= 9 && x < 100000; ++e)
+                        x = x * 10 + (*e - '0');
+                    exp += eneg ? -x : x;
+                    first = e;
+                }
+                constexpr int bits = std::numeric_limits<T>::digits < 53 ?
+                    std::numeric_limits<T>::digits : 53;
+                constexpr int max_exp = bits < 53 ? 10 : 22;
+                if(!any || first != last || digits > 19 || m > (std::uint64_t(1) << bits) ||
+                    exp < -max_exp || exp > max_exp)
+                    return parse_float_slow_<T>(token, last);
+                T d = static_cast<T>(m);
+                d = exp < 0 ? d / static_cast<T>(pow10[-exp]) : d * static_cast<T>(pow10[exp]);
+                return neg ? -d : d;
+            }
+
+            using char_set_ = std::array<bool, 256>;
+
+            inline char_set_ make_char_set_(char const *chars)
+            {
+                char_set_ set{};
+                for(; *chars; ++chars)
+                    set[static_cast<unsigned char>(*chars)] = true;
+                return set;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief The numbers in a buffer of text, parsed as they are read.
+        ///
+        /// Tokens are the runs of characters between delimiters. Each is parsed as a
+        /// \c T, an integral or floating-point type, without going through a stream or
+        /// the locale: integers are accumulated digit by digit with an overflow check,
+        /// and most decimal floating-point numbers are computed exactly from their
+        /// digits, the rest falling back to `strtof`, `strtod` or `strtold`. A token
+        /// that isn't a number throws `std::invalid_argument`; one that doesn't fit in
+        /// \c T throws `std::out_of_range`.
+        ///
+        /// The view refers to the buffer, which must outlive it. For parallel
+        /// parsing, `partition(n)` cuts it into pieces that start and end at
+        /// delimiters, each of which can be parsed independently.
+        template<typename T>
+        struct parse_view
+          : view_facade<parse_view<T>, finite>
+        {
+        private:
+            friend range_access;
+            char const *begin_, *end_;
+            detail::char_set_ delims_;
+
+            struct cursor
+            {
+            private:
+                parse_view const *rng_;
+                char const *first_, *last_;
+                T value_;
+                void satisfy()
+                {
+                    auto const &delims = rng_->delims_;
+                    char const *const end = rng_->end_;
+                    while(first_ != end && delims[static_cast<unsigned char>(*first_)])
+                        ++first_;
+                    for(last_ = first_; last_ != end && !delims[static_cast<unsigned char>(*last_)];)
+                        ++last_;
+                    if(first_ != last_)
+                        value_ = detail::parse_number_<T>(first_, last_);
+                }
+            public:
+                cursor() = default;
+                cursor(parse_view const &rng, char const *first)
+                  : rng_(&rng), first_(first), last_(first), value_{}
+                {
+                    satisfy();
+                }
+                T current() const
+                {
+                    return value_;
+                }
+                void next()
+                {
+                    first_ = last_;
+                    satisfy();
+                }
+                bool equal(cursor const &that) const
+                {
+                    return first_ == that.first_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, begin_};
+            }
+            cursor end_cursor() const
+            {
+                return {*this, end_};
+            }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<T>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                for(char const *first = begin_;;)
+                {
+                    while(first != end_ && delims_[static_cast<unsigned char>(*first)])
+                        ++first;
+                    if(first == end_)
+                        return true;
+                    char const *last = first;
+                    while(last != end_ && !delims_[static_cast<unsigned char>(*last)])
+                        ++last;
+                    if(!sink(detail::parse_number_<T>(first, last)))
+                        return false;
+                    first = last;
+                }
+            }
+        public:
+            parse_view() = default;
+            parse_view(char const *first, char const *last, detail::char_set_ delims)
+              : begin_(first), end_(last), delims_(delims)
+            {}
+            /// \return At most \c n views, or one if \c n is 0, that together parse the
+            /// same numbers as this one, split at delimiters into pieces of about the
+            /// same length.
+            std::vector<parse_view> partition(std::size_t n) const
+            {
+                auto const &delims = delims_;
+                std::vector<parse_view> parts;
+                for(auto part : detail::partition_buffer_(begin_, end_, n,
+                    [&](char c) { return delims[static_cast<unsigned char>(c)]; }))
+                    parts.push_back(parse_view{part.begin(), part.end(), delims_});
+                return parts;
+            }
+        };
+
+        namespace view
+        {
+            /// \relates parse_view
+            /// Parses the numbers in a contiguous buffer of chars, like a \c std::string
+            /// or a \c mapped_file_view, that are separated by any of \c delims.
+            /// TODO use a variable template here when they're available
+            template<typename T, typename Rng,
+                CONCEPT_REQUIRES_(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value),
+                typename B = decltype(detail::char_buffer_(std::declval<Rng &>(), 42))>
+            parse_view<T> parse(Rng &rng, char const *delims = " \t\n\v\f\r")
+            {
+                B buf = detail::char_buffer_(rng, 42);
+                return {buf.begin(), buf.end(), detail::make_char_set_(delims)};
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
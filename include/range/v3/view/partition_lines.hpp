@@ -0,0 +1,150 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PARTITION_LINES_HPP
+#define RANGES_V3_VIEW_PARTITION_LINES_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief A buffer of text cut into \c n pieces of about the same length, each
+        /// of which is a whole number of lines.
+        ///
+        /// Piece \c i starts at the first line that starts at or after `i/n` of the
+        /// way through the buffer, and ends where piece `i+1` starts. Together the
+        /// pieces cover the buffer exactly, and any of them can be read with \c getlines
+        /// or \c view::split, on its own thread, without knowing about the others.
+        /// Lines longer than a piece leave some pieces empty. Finding a piece's bounds
+        /// takes a \c memchr from the cut point to the next delimiter, so the view is
+        /// random-access and nothing is computed or allocated up front.
+        struct partition_lines_view
+          : view_facade<partition_lines_view, finite>
+        {
+        private:
+            friend range_access;
+            char const *begin_, *end_;
+            std::size_t n_;
+            char delim_;
+
+            char const *cut(std::size_t i) const
+            {
+                if(0 == i || n_ == i)
+                    return 0 == i ? begin_ : end_;
+                std::size_t const size = static_cast<std::size_t>(end_ - begin_);
+                char const *p = begin_ + (size / n_ * i + size % n_ * i / n_);
+                // Don't move a cut that is already at the start of a line.
+                if(p == begin_)
+                    return p;
+                p = static_cast<char const *>(
+                    std::memchr(p - 1, delim_, static_cast<std::size_t>(end_ - (p - 1))));
+                return p ? p + 1 : end_;
+            }
+
+            struct cursor
+            {
+            private:
+                partition_lines_view const *rng_;
+                std::size_t i_;
+            public:
+                cursor() = default;
+                cursor(partition_lines_view const &rng, std::size_t i)
+                  : rng_(&rng), i_(i)
+                {}
+                range<char const *> current() const
+                {
+                    return {rng_->cut(i_), rng_->cut(i_ + 1)};
+                }
+                void next()
+                {
+                    ++i_;
+                }
+                void prev()
+                {
+                    --i_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    i_ = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(i_) + n);
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return static_cast<std::ptrdiff_t>(that.i_) - static_cast<std::ptrdiff_t>(i_);
+                }
+                bool equal(cursor const &that) const
+                {
+                    return i_ == that.i_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, 0};
+            }
+            cursor end_cursor() const
+            {
+                return {*this, n_};
+            }
+        public:
+            partition_lines_view() = default;
+            partition_lines_view(char const *first, char const *last, std::size_t n,
+                char delim = '\n')
+              : begin_(first), end_(last), n_(first == last ? 0 : n), delim_(delim)
+            {
+                RANGES_ASSERT(0 < n || first == last);
+            }
+            std::size_t size() const
+            {
+                return n_;
+            }
+        };
+
+        namespace view
+        {
+            struct partition_lines_fn
+            {
+                /// Cuts a contiguous buffer of chars, like a \c std::string or a
+                /// \c mapped_file_view, into \c n pieces at line boundaries. The pieces
+                /// point into the buffer, so it must outlive them.
+                template<typename Rng,
+                    typename B = decltype(detail::char_buffer_(std::declval<Rng &>(), 42))>
+                partition_lines_view operator()(Rng & rng, std::size_t n, char delim = '\n') const
+                {
+                    B buf = detail::char_buffer_(rng, 42);
+                    return {buf.begin(), buf.end(), n, delim};
+                }
+            };
+
+            /// \relates partition_lines_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& partition_lines = static_const<partition_lines_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,139 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_VIEW_PREPARE_HPP
+#define RANGES_V3_VIEW_PREPARE_HPP
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_interface.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace adl_prepare_detail
+        {
+            // A view whose iterators write to it, and not only its begin() and end(),
+            // has a prepare_view_ found by ADL that does those writes. Adaptors pass
+            // it on to the views they adapt.
+            template<typename Rng>
+            void prepare_view_(Rng &, long)
+            {}
+            template<typename Rng,
+                CONCEPT_REQUIRES_(std::is_lvalue_reference<
+                    decltype(std::declval<Rng &>().base())>::value)>
+            void prepare_view_(Rng &rng, int)
+            {
+                prepare_view_(rng.base(), 0);
+            }
+            template<typename Rng>
+            void prepare(Rng &rng)
+            {
+                prepare_view_(rng, 0);
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief A view whose begin and end are computed once, up front.
+        ///
+        /// Views like `remove_if`, `drop_while`, `slice` and `reverse` find their begin or
+        /// end lazily and cache it inside the view, so their `begin()` and `end()` are
+        /// non-const and must not be called on the same object from several threads.
+        /// `prepared_view` asks the underlying view for its begin and end when it is
+        /// constructed and only hands out copies of them afterward, so that any number of
+        /// threads can iterate it (or copies of it) concurrently. A `cycle` of a range
+        /// whose end is a sentinel caches the end of that range when its iterators
+        /// first reach it; that is done up front too. The underlying view is held by
+        /// shared pointer so the iterators stay valid when the view is copied.
+        template<typename Rng>
+        struct prepared_view
+          : view_interface<prepared_view<Rng>, range_cardinality<Rng>::value>
+        {
+        private:
+            std::shared_ptr<Rng> rng_;
+            range_iterator_t<Rng> begin_;
+            range_sentinel_t<Rng> end_;
+
+        public:
+            using iterator = range_iterator_t<Rng>;
+            using sentinel = range_sentinel_t<Rng>;
+
+            prepared_view() = default;
+            explicit prepared_view(Rng rng)
+              : rng_(std::make_shared<Rng>(std::move(rng)))
+              , begin_(ranges::begin(*rng_))
+              , end_(ranges::end(*rng_))
+            {
+                adl_prepare_detail::prepare(*rng_);
+            }
+            iterator begin() const
+            {
+                return begin_;
+            }
+            sentinel end() const
+            {
+                return end_;
+            }
+            Rng const & base() const
+            {
+                return *rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct prepare_fn
+            {
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(ForwardRange<Rng>::value)>
+                prepared_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return prepared_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!ForwardRange<Rng>::value)>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which view::prepare operates must be a model of the "
+                        "ForwardRange concept. Iterating an input range consumes it, so there "
+                        "is nothing to share between threads.");
+                }
+            #endif
+            };
+
+            /// \relates prepare_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& prepare = static_const<view<prepare_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,249 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_RECORDS_HPP
+#define RANGES_V3_VIEW_RECORDS_HPP
+
+#include <cerrno>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <type_traits>
+#include <system_error>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/sink.hpp>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Reads as many bytes as it can, up to n, from a stream or a file
+            // descriptor. Returns fewer than n only at the end of the input.
+            struct record_source_
+            {
+            private:
+                std::istream *sin_;
+                int fd_;
+                std::size_t read_fd(char *buf, std::size_t n)
+                {
+                    std::size_t got = 0;
+                    while(got != n)
+                    {
+#ifdef _WIN32
+                        int const m = ::_read(fd_, buf + got,
+                            static_cast<unsigned>(n - got < (1u << 30) ? n - got : (1u << 30)));
+#else
+                        ::ssize_t const m = ::read(fd_, buf + got, n - got);
+#endif
+                        if(m < 0)
+                        {
+                            if(EINTR == errno)
+                                continue;
+                            throw std::system_error(errno, std::system_category(), "read");
+                        }
+                        if(0 == m)
+                            break;
+                        got += static_cast<std::size_t>(m);
+                    }
+                    return got;
+                }
+            public:
+                explicit record_source_(std::istream &sin)
+                  : sin_(&sin), fd_(-1)
+                {}
+                explicit record_source_(int fd)
+                  : sin_(nullptr), fd_(fd)
+                {}
+                std::size_t read(char *buf, std::size_t n)
+                {
+                    if(!sin_)
+                        return read_fd(buf, n);
+                    sin_->read(buf, static_cast<std::streamsize>(n));
+                    return static_cast<std::size_t>(sin_->gcount());
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// \brief The fixed-size binary records of a stream or a file descriptor, read
+        /// a block at a time.
+        ///
+        /// Records are read into a buffer of \c block_size bytes, which is reused for
+        /// every block, and the elements of the range are references into it, so they
+        /// are only good until the iterator moves past the end of the block. A
+        /// trailing partial record, if the input's size isn't a multiple of
+        /// `sizeof(T)`, is not part of the range. Like \c istream_range, this is a
+        /// single-pass range, and copies of it share their position in the input.
+        /// Reading from a file descriptor throws `std::system_error` if it fails;
+        /// a stream reports failures through its own state. \c T must be trivially
+        /// copyable.
+        template<typename T>
+        struct records_view
+          : view_facade<records_view<T>, unknown>
+        {
+        private:
+            static_assert(detail::is_trivially_copyable<T>::value,
+                "Only trivially copyable records can be read as raw bytes.");
+            friend range_access;
+            using storage_t = meta::_t<std::aligned_storage<sizeof(T), alignof(T)>>;
+            struct state
+            {
+                detail::record_source_ src_;
+                std::unique_ptr<storage_t[]> buf_;
+                std::size_t capacity_;  // in records
+                std::size_t size_;      // records in the buffer
+                std::size_t pos_;       // the current record
+                std::size_t partial_;   // bytes of the next record after the last one
+
+                state(detail::record_source_ src, std::size_t capacity)
+                  : src_(src), buf_(new storage_t[capacity]), capacity_(capacity)
+                  , size_(0), pos_(0), partial_(0)
+                {
+                    fill();
+                }
+                void fill()
+                {
+                    char *const bytes = reinterpret_cast<char *>(buf_.get());
+                    std::memmove(bytes, bytes + size_ * sizeof(T), partial_);
+                    std::size_t const n = partial_ +
+                        src_.read(bytes + partial_, capacity_ * sizeof(T) - partial_);
+                    size_ = n / sizeof(T);
+                    partial_ = n % sizeof(T);
+                    pos_ = 0;
+                }
+            };
+            std::shared_ptr<state> state_;
+
+            struct cursor
+            {
+            private:
+                state *state_;
+            public:
+                cursor() = default;
+                explicit cursor(state &s)
+                  : state_(&s)
+                {}
+                T const &current() const
+                {
+                    return reinterpret_cast<T const *>(state_->buf_.get())[state_->pos_];
+                }
+                void next()
+                {
+                    if(++state_->pos_ == state_->size_ && state_->size_ == state_->capacity_)
+                        state_->fill();
+                }
+                bool done() const
+                {
+                    return state_->pos_ == state_->size_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return cursor{*state_};
+            }
+        public:
+            records_view() = default;
+            records_view(std::istream &sin, std::size_t block_size = std::size_t(1) << 20)
+              : state_(std::make_shared<state>(detail::record_source_{sin}, records(block_size)))
+            {}
+            records_view(int fd, std::size_t block_size = std::size_t(1) << 20)
+              : state_(std::make_shared<state>(detail::record_source_{fd}, records(block_size)))
+            {}
+        private:
+            static std::size_t records(std::size_t block_size)
+            {
+                return block_size < sizeof(T) ? 1 : block_size / sizeof(T);
+            }
+        };
+
+        /// \brief An output iterator that writes the bytes of each record assigned
+        /// through it to an \c ostream_sink or \c fd_sink, which buffers them.
+        template<typename T, typename Sink>
+        struct record_output_iterator
+        {
+        private:
+            static_assert(detail::is_trivially_copyable<T>::value,
+                "Only trivially copyable records can be written as raw bytes.");
+            basic_sink<Sink> *sink_;
+            struct proxy
+            {
+                basic_sink<Sink> *sink_;
+                proxy &operator=(T const &t)
+                {
+                    sink_->write(reinterpret_cast<char const *>(&t), sizeof(T));
+                    return *this;
+                }
+            };
+        public:
+            using difference_type = std::ptrdiff_t;
+            record_output_iterator() = default;
+            explicit record_output_iterator(basic_sink<Sink> &sink) noexcept
+              : sink_(&sink)
+            {}
+            proxy operator*() const noexcept
+            {
+                return {sink_};
+            }
+            record_output_iterator &operator++()
+            {
+                return *this;
+            }
+            record_output_iterator &operator++(int)
+            {
+                return *this;
+            }
+        };
+
+        /// \relates record_output_iterator
+        template<typename T, typename Sink>
+        record_output_iterator<T, Sink> records_out(basic_sink<Sink> &sink)
+        {
+            return record_output_iterator<T, Sink>{sink};
+        }
+
+        namespace view
+        {
+            /// \relates records_view
+            /// TODO use a variable template here when they're available
+            template<typename T>
+            records_view<T> records(std::istream &sin, std::size_t block_size = std::size_t(1) << 20)
+            {
+                return records_view<T>{sin, block_size};
+            }
+
+            /// \relates records_view
+            template<typename T>
+            records_view<T> records(int fd, std::size_t block_size = std::size_t(1) << 20)
+            {
+                return records_view<T>{fd, block_size};
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
@@ -33,6 +34,25 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Passes on the elements that do not satisfy the predicate.
+            template<typename Pred, typename Sink>
+            struct remove_if_sink
+            {
+                Pred &pred_;
+                Sink &sink_;
+                template<typename T>
+                auto operator()(T &&t) const ->
+                    decltype(sink_(static_cast<T &&>(t)))
+                {
+                    return pred_(t) || sink_(static_cast<T &&>(t));
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Pred>
@@ -98,6 +118,13 @@ namespace ranges
             {
                 return {*this};
             }
+            template<typename Sink,
+                typename S = detail::remove_if_sink<semiregular_t<function_type<Pred>>, Sink>>
+            auto for_each_while(Sink &sink) ->
+                decltype(ranges::for_each_while(std::declval<Rng &>(), std::declval<S>()))
+            {
+                return ranges::for_each_while(this->mutable_base(), S{pred_, sink});
+            }
         public:
             remove_if_view() = default;
             remove_if_view(remove_if_view &&that)
@@ -86,6 +86,15 @@ namespace ranges
             {
                 return {value_, n_};
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<Val>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                for(std::ptrdiff_t n = n_; n != 0; --n)
+                    if(!sink(static_cast<Val>(value_)))
+                        return false;
+                return true;
+            }
         public:
             repeat_n_view() = default;
             constexpr repeat_n_view(Val value, std::ptrdiff_t n)
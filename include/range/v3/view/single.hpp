@@ -83,6 +83,12 @@ namespace ranges
             {
                 return {value_};
             }
+            template<typename Sink,
+                typename R = decltype(std::declval<Sink &>()(std::declval<Val>()))>
+            bool for_each_while(Sink &sink) const
+            {
+                return sink(static_cast<Val>(value_));
+            }
         public:
             single_view() = default;
             constexpr explicit single_view(Val value)
@@ -52,11 +52,17 @@ namespace ranges
 
             // Bidirectional and random-access stride iterators need to remember how
             // far past they end they are, so that when they're decremented, they can
-            // visit the correct elements.
+            // visit the correct elements. For sized ranges that is known as soon as
+            // the end iterator is made, so it is a plain integer. Otherwise it is
+            // computed lazily, and atomically since iterators may be shared across
+            // threads.
             using offset_t =
                 meta::if_<
                     BidirectionalRange<Rng>,
-                    mutable_<std::atomic<difference_type_>>,
+                    meta::if_<
+                        SizedRange<Rng>,
+                        mutable_<difference_type_>,
+                        mutable_<std::atomic<difference_type_>>>,
                     constant<difference_type_, 0>>;
 
             difference_type_ stride_;
@@ -68,11 +74,10 @@ namespace ranges
                 stride_view const *rng_;
                 offset_t & offset() { return *this; }
                 offset_t const & offset() const { return *this; }
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                CONCEPT_REQUIRES(BidirectionalRange<Rng>::value)
-#else
-                CONCEPT_REQUIRES(BidirectionalRange<Rng>())
-#endif
+                CONCEPT_REQUIRES(BidirectionalRange<Rng>::value && SizedRange<Rng>::value)
+                void clean() const
+                {}
+                CONCEPT_REQUIRES(BidirectionalRange<Rng>::value && !SizedRange<Rng>::value)
                 void clean() const
                 {
                     std::atomic<difference_type_> &off = offset();
@@ -176,6 +181,21 @@ namespace ranges
             {
                 return {*this, end_tag{}};
             }
+            // The elements of a sized random-access range can be reached directly by
+            // index, without bounds-checking each step against the end.
+            template<typename Sink,
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && SizedRange<Rng>::value),
+                typename R = decltype(std::declval<Sink &>()(
+                    *ranges::begin(std::declval<Rng &>())))>
+            bool for_each_while(Sink &sink) const
+            {
+                auto const first = ranges::begin(this->mutable_base());
+                auto const n = static_cast<difference_type_>(ranges::size(this->base()));
+                for(difference_type_ i = 0; i < n; i += stride_)
+                    if(!sink(first[i]))
+                        return false;
+                return true;
+            }
         public:
             stride_view() = default;
             stride_view(Rng rng, difference_type_ stride)
@@ -86,6 +86,12 @@ namespace ranges
             {
                 return {ranges::end(rng_)};
             }
+            template<typename Sink>
+            auto for_each_while(Sink &sink) ->
+                decltype(detail::take_for_each_while(std::declval<Rng &>(), 0, sink))
+            {
+                return detail::take_for_each_while(rng_, n_, sink);
+            }
         public:
             take_view() = default;
             take_view(Rng rng, difference_type_ n)
@@ -19,6 +19,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_interface.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/range.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/counted_iterator.hpp>
@@ -43,6 +44,36 @@ namespace ranges
 #endif
             {};
 
+            // Passes at most n elements to the sink, and stops the base range as soon
+            // as the n-th has been passed so that no further element is computed.
+            template<typename Sink, typename Difference>
+            struct take_sink
+            {
+                Sink &sink_;
+                Difference n_;
+                bool stopped_;
+                template<typename T>
+                auto operator()(T &&t) ->
+                    decltype(sink_(static_cast<T &&>(t)), bool())
+                {
+                    if(!sink_(static_cast<T &&>(t)))
+                        return !(stopped_ = true);
+                    return --n_ != 0;
+                }
+            };
+
+            template<typename Rng, typename Sink>
+            auto take_for_each_while(Rng &rng, range_difference_t<Rng> n, Sink &sink) ->
+                decltype(ranges::for_each_while(rng,
+                    std::declval<take_sink<Sink, range_difference_t<Rng>> &>()))
+            {
+                if(n == 0)
+                    return true;
+                take_sink<Sink, range_difference_t<Rng>> s{sink, n, false};
+                ranges::for_each_while(rng, s);
+                return !s.stopped_;
+            }
+
             // BUGBUG Per the discussion in https://github.com/ericniebler/stl2/issues/63, it's
             // unclear if we can infer anything from RandomAccessRange<Rng>() && BoundedRange<Rng>()
             template<typename Rng,
@@ -74,6 +105,12 @@ namespace ranges
                 {
                     return {};
                 }
+                template<typename Sink>
+                auto for_each_while(Sink &sink) ->
+                    decltype(detail::take_for_each_while(std::declval<Rng &>(), 0, sink))
+                {
+                    return detail::take_for_each_while(rng_, n_, sink);
+                }
             public:
                 take_exactly_view_() = default;
                 take_exactly_view_(Rng rng, difference_type_ n)
@@ -100,9 +137,17 @@ namespace ranges
               : view_interface<take_exactly_view_<Rng, true>, finite>
             {
             private:
+                friend range_access;
                 using difference_type_ = range_difference_t<Rng>;
                 Rng rng_;
                 difference_type_ n_;
+
+                template<typename Sink>
+                auto for_each_while(Sink &sink) ->
+                    decltype(detail::take_for_each_while(std::declval<Rng &>(), 0, sink))
+                {
+                    return detail::take_for_each_while(rng_, n_, sink);
+                }
             public:
                 take_exactly_view_() = default;
                 take_exactly_view_(Rng rng, difference_type_ n)
@@ -20,9 +20,12 @@
 #include <type_traits>
 #include <initializer_list>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/view_facade.hpp>
 #include <range/v3/view_interface.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/dfa_regex.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
@@ -83,11 +86,145 @@ namespace ranges
             }
         };
 
+        /// \brief The tokens of a character range, found with a \c dfa_regex.
+        ///
+        /// With \c sub equal to 0 the tokens are the matches; with -1 they are the
+        /// pieces of text between the matches, as with `std::regex_token_iterator`.
+        /// The tokens are subranges of the underlying range, so nothing is allocated
+        /// or copied per token.
+        template<typename Rng>
+        struct dfa_tokenize_view
+          : view_facade<
+                dfa_tokenize_view<Rng>,
+                is_finite<Rng>::value ? finite : range_cardinality<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using iterator_t = range_iterator_t<Rng const>;
+            Rng rng_;
+            dfa_regex rex_;
+            int sub_;
+
+            struct cursor
+            {
+            private:
+                dfa_regex const *rex_;
+                iterator_t first_, last_, next_, end_;
+                int sub_;
+                bool tail_, done_;
+
+                void satisfy()
+                {
+                    auto const m = rex_->search(next_, end_);
+                    if(0 == sub_)
+                    {
+                        first_ = m.first;
+                        last_ = next_ = m.second;
+                        done_ = m.first == m.second;
+                    }
+                    else if(m.first != m.second)
+                    {
+                        first_ = next_;
+                        last_ = m.first;
+                        next_ = m.second;
+                    }
+                    else
+                    {
+                        // The text after the last match is a token if it isn't empty.
+                        first_ = next_;
+                        last_ = next_ = end_;
+                        tail_ = true;
+                        done_ = first_ == last_;
+                    }
+                }
+            public:
+                cursor() = default;
+                cursor(dfa_regex const &rex, iterator_t first, iterator_t last, int sub)
+                  : rex_(&rex), first_(first), last_(first), next_(first), end_(last)
+                  , sub_(sub), tail_(false), done_(false)
+                {
+                    satisfy();
+                }
+                cursor(dfa_regex const &rex, iterator_t last)
+                  : rex_(&rex), first_(last), last_(last), next_(last), end_(last)
+                  , sub_(0), tail_(false), done_(true)
+                {}
+                range<iterator_t> current() const
+                {
+                    return {first_, last_};
+                }
+                void next()
+                {
+                    if(tail_)
+                        done_ = true;
+                    else
+                        satisfy();
+                }
+                bool equal(cursor const &that) const
+                {
+                    return next_ == that.next_ && done_ == that.done_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {rex_, ranges::begin(rng_), ranges::end(rng_), sub_};
+            }
+            cursor end_cursor() const
+            {
+                return {rex_, ranges::end(rng_)};
+            }
+        public:
+            dfa_tokenize_view() = default;
+            dfa_tokenize_view(Rng rng, dfa_regex rex, int sub)
+              : rng_(std::move(rng))
+              , rex_(std::move(rex))
+              , sub_(sub)
+            {
+                RANGES_ASSERT(0 == sub_ || -1 == sub_);
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
         namespace view
         {
             struct tokenizer_impl_fn
             {
-                template<typename Rng, typename Regex>
+                template<typename Regex>
+                using StdRegex = meta::not_<std::is_same<uncvref_t<Regex>, dfa_regex>>;
+
+                template<typename Rng>
+                using DfaTokenizable = meta::and_<
+                    ForwardRange<Rng const>,
+                    BoundedRange<Rng const>,
+                    meta::bool_<sizeof(range_value_t<Rng>) == 1>>;
+
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(DfaTokenizable<Rng>::value)>
+                dfa_tokenize_view<all_t<Rng>>
+                operator()(Rng && rng, dfa_regex rex, int sub = 0) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(rex), sub};
+                }
+
+                template<typename Regex,
+                    CONCEPT_REQUIRES_(!StdRegex<Regex>::value)>
+                auto operator()(Regex && rex, int sub = 0) const ->
+                    decltype(make_pipeable(std::bind(*this, std::placeholders::_1,
+                        dfa_regex(std::forward<Regex>(rex)), std::move(sub))))
+                {
+                    return make_pipeable(std::bind(*this, std::placeholders::_1,
+                        dfa_regex(std::forward<Regex>(rex)), std::move(sub)));
+                }
+
+                template<typename Rng, typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 tokenize_view<all_t<Rng>, Regex, int>
                 operator()(Rng && rng, Regex && rex, int sub = 0,
                     std::regex_constants::match_flag_type flags =
@@ -102,7 +239,8 @@ namespace ranges
                             flags};
                 }
 
-                template<typename Rng, typename Regex>
+                template<typename Rng, typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 tokenize_view<all_t<Rng>, Regex, std::vector<int>>
                 operator()(Rng && rng, Regex && rex, std::vector<int> subs,
                     std::regex_constants::match_flag_type flags =
@@ -117,7 +255,8 @@ namespace ranges
                             std::move(subs), flags};
                 }
 
-                template<typename Rng, typename Regex>
+                template<typename Rng, typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 tokenize_view<all_t<Rng>, Regex, std::initializer_list<int>>
                 operator()(Rng && rng, Regex && rex,
                     std::initializer_list<int> subs, std::regex_constants::match_flag_type flags =
@@ -132,7 +271,8 @@ namespace ranges
                             std::move(subs), flags};
                 }
 
-                template<typename Regex>
+                template<typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 auto operator()(Regex && rex, int sub = 0,
                     std::regex_constants::match_flag_type flags =
                         std::regex_constants::match_default) const ->
@@ -143,7 +283,8 @@ namespace ranges
                         std::move(sub), std::move(flags)));
                 }
 
-                template<typename Regex>
+                template<typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 auto operator()(Regex && rex, std::vector<int> subs,
                     std::regex_constants::match_flag_type flags =
                         std::regex_constants::match_default) const ->
@@ -154,7 +295,8 @@ namespace ranges
                         std::move(subs), std::move(flags)));
                 }
 
-                template<typename Regex>
+                template<typename Regex,
+                    CONCEPT_REQUIRES_(StdRegex<Regex>::value)>
                 auto operator()(Regex && rex,
                     std::initializer_list<int> subs, std::regex_constants::match_flag_type flags =
                         std::regex_constants::match_default) const ->
@@ -25,6 +25,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -49,6 +50,30 @@ namespace ranges
                             unknown :
                             infinite;
             }
+
+            template<typename Fun>
+            struct is_indirected_
+              : std::false_type
+            {};
+
+            template<typename Fn>
+            struct is_indirected_<indirected<Fn>>
+              : std::true_type
+            {};
+
+            // Applies an iterator-based function to each element before passing it on.
+            template<typename Fun, typename Sink>
+            struct iter_transform_sink
+            {
+                Fun &fun_;
+                Sink &sink_;
+                template<typename T>
+                auto operator()(T &&t) const ->
+                    decltype(sink_(fun_(element_ref<T>{t})))
+                {
+                    return sink_(fun_(element_ref<T>{t}));
+                }
+            };
         }
         /// \endcond
 
@@ -115,6 +140,16 @@ namespace ranges
             {
                 return {fun_};
             }
+            // Internal iteration is available when the function only dereferences the
+            // iterators it is given, as in transform_view.
+            template<typename Sink,
+                typename S = detail::iter_transform_sink<semiregular_t<function_type<Fun>>, Sink>,
+                CONCEPT_REQUIRES_(detail::is_indirected_<Fun>::value)>
+            auto for_each_while(Sink &sink) ->
+                decltype(ranges::for_each_while(std::declval<Rng &>(), std::declval<S>()))
+            {
+                return ranges::for_each_while(this->mutable_base(), S{fun_, sink});
+            }
         public:
             iter_transform_view() = default;
             iter_transform_view(Rng rng, Fun fun)
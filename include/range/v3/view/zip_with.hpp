@@ -76,6 +76,15 @@ namespace ranges
                 }
             } advance_ {};
 
+            constexpr struct
+            {
+                template<typename T, typename D>
+                T operator()(T const &t, D d) const
+                {
+                    return t + d;
+                }
+            } next_ {};
+
             constexpr struct
             {
                 template<typename T>
@@ -285,6 +294,99 @@ namespace ranges
                 }
             };
 
+            // When every range is sized and random-access, the zipped ranges are
+            // traversed with a single index from their beginnings, up to the length of
+            // the shortest, instead of by comparing every iterator at every step.
+            using indexed_ =
+                meta::and_c<
+                    (bool) RandomAccessRange<Rngs>::value...,
+                    (bool) SizedRange<Rngs>::value...>;
+
+            struct indexed_cursor
+            {
+            private:
+                using fun_ref_ = semiregular_ref_or_val_t<function_type<Fun>, true>;
+                fun_ref_ fun_;
+                std::tuple<range_iterator_t<Rngs>...> begins_;
+                common_type_t<range_difference_t<Rngs>...> n_;
+
+                template<std::size_t...Is>
+                auto current_(meta::index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_((std::get<Is>(begins_) + n_)...)
+                )
+                template<std::size_t...Is>
+                auto indirect_move_(meta::index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_(move_tag{}, (std::get<Is>(begins_) + n_)...)
+                )
+                template<typename Sent>
+                friend auto indirect_move(basic_iterator<indexed_cursor, Sent> const &it)
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    get_cursor(it).indirect_move_(meta::make_index_sequence<sizeof...(Rngs)>{})
+                )
+            public:
+                using difference_type =
+                    common_type_t<range_difference_t<Rngs>...>;
+                using single_pass = std::false_type;
+                using value_type =
+                    detail::decay_t<decltype(fun_(copy_tag{}, range_iterator_t<Rngs>{}...))>;
+
+                /// Gives access to the position of the iterator in each of the zipped
+                /// ranges, so that loops over columns of data can index them directly.
+                struct mixin
+                  : basic_mixin<indexed_cursor>
+                {
+                    mixin() = default;
+                    mixin(indexed_cursor pos)
+                      : basic_mixin<indexed_cursor>{std::move(pos)}
+                    {}
+                    std::tuple<range_iterator_t<Rngs>...> bases() const
+                    {
+                        return tuple_transform(this->get().begins_,
+                            std::bind(detail::next_, std::placeholders::_1, this->get().n_));
+                    }
+                    difference_type index() const
+                    {
+                        return this->get().n_;
+                    }
+                };
+
+                indexed_cursor() = default;
+                indexed_cursor(fun_ref_ fun, std::tuple<range_iterator_t<Rngs>...> begins,
+                        difference_type n)
+                  : fun_(std::move(fun)), begins_(std::move(begins)), n_(n)
+                {}
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    this->current_(meta::make_index_sequence<sizeof...(Rngs)>{})
+                )
+                void next()
+                {
+                    ++n_;
+                }
+                void prev()
+                {
+                    --n_;
+                }
+                void advance(difference_type n)
+                {
+                    n_ += n;
+                }
+                bool equal(indexed_cursor const &that) const
+                {
+                    return n_ == that.n_;
+                }
+                difference_type distance_to(indexed_cursor const &that) const
+                {
+                    return that.n_ - n_;
+                }
+            };
+
             using end_cursor_t =
                 meta::if_<
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
@@ -307,6 +409,47 @@ namespace ranges
                     cursor,
                     sentinel>;
 
+            template<typename Self>
+            static indexed_cursor indexed_cursor_(Self &self, difference_type_ n)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, ranges::begin), n};
+            }
+            CONCEPT_REQUIRES(indexed_::value)
+            indexed_cursor begin_cursor()
+            {
+                return iter_zip_with_view::indexed_cursor_(*this, 0);
+            }
+            CONCEPT_REQUIRES(indexed_::value)
+            indexed_cursor end_cursor()
+            {
+                return iter_zip_with_view::indexed_cursor_(*this,
+                    static_cast<difference_type_>(size()));
+            }
+            CONCEPT_REQUIRES(indexed_::value && meta::and_c<(bool) Range<Rngs const>::value...>::value)
+            indexed_cursor begin_cursor() const
+            {
+                return iter_zip_with_view::indexed_cursor_(*this, 0);
+            }
+            CONCEPT_REQUIRES(indexed_::value && meta::and_c<(bool) Range<Rngs const>::value...>::value)
+            indexed_cursor end_cursor() const
+            {
+                return iter_zip_with_view::indexed_cursor_(*this,
+                    static_cast<difference_type_>(size()));
+            }
+            // A plain counted loop over the zipped elements.
+            template<typename Sink, typename Cur = indexed_cursor,
+                CONCEPT_REQUIRES_(indexed_::value),
+                typename R = decltype(std::declval<Sink &>()(std::declval<Cur &>().current()))>
+            bool for_each_while(Sink &sink)
+            {
+                Cur pos = begin_cursor();
+                for(auto n = static_cast<difference_type_>(size()); 0 != n; --n, pos.next())
+                    if(!sink(pos.current()))
+                        return false;
+                return true;
+            }
+
+            CONCEPT_REQUIRES(!indexed_::value)
             cursor begin_cursor()
             {
 #ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
@@ -315,6 +458,7 @@ namespace ranges
                 return {fun_, tuple_transform(rngs_, begin)};
 #endif
             }
+            CONCEPT_REQUIRES(!indexed_::value)
             end_cursor_t end_cursor()
             {
 #ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
@@ -324,9 +468,9 @@ namespace ranges
 #endif
             }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
-            CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>::value...>::value)
+            CONCEPT_REQUIRES(!indexed_::value && meta::and_c<(bool) Range<Rngs const>::value...>::value)
 #else
-            CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>()...>::value)
+            CONCEPT_REQUIRES(!indexed_::value && meta::and_c<(bool) Range<Rngs const>()...>::value)
 #endif
             cursor begin_cursor() const
             {
@@ -337,9 +481,9 @@ namespace ranges
 #endif
             }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
-            CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>::value...>::value)
+            CONCEPT_REQUIRES(!indexed_::value && meta::and_c<(bool) Range<Rngs const>::value...>::value)
 #else
-            CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>()...>::value)
+            CONCEPT_REQUIRES(!indexed_::value && meta::and_c<(bool) Range<Rngs const>()...>::value)
 #endif
             end_cursor_t end_cursor() const
             {
@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <chrono>
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+using triple = std::tuple<int, int, int>;
+
+static constexpr int max_triples = 3000;
+
+int sum_triple(triple const &t)
+{
+    return std::get<0>(t) + std::get<1>(t) + std::get<2>(t);
+}
+
+int main()
+{
+    // All the Pythagorean triples, as in example/comprehensions.cpp:
+    auto triples =
+        view::for_each(view::ints(1), [](int z)
+        {
+            return view::for_each(view::ints(1, z+1), [=](int x)
+            {
+                return view::for_each(view::ints(x, z+1), [=](int y)
+                {
+                    return yield_if(x*x + y*y == z*z, std::make_tuple(x, y, z));
+                });
+            });
+        });
+
+    // Pulling the elements through the iterators of the nested joins:
+    timer t;
+    int result = 0;
+    RANGES_FOR(auto triple, triples | view::take(max_triples))
+    {
+        result += sum_triple(triple);
+    }
+    std::cout << "RANGES_FOR:  " << t << " (" << result << ")\n";
+
+    // Pushing them with internal iteration:
+    t.reset();
+    result = accumulate(triples | view::take(max_triples), 0, plus{}, sum_triple);
+    std::cout << "accumulate:  " << t << " (" << result << ")\n";
+
+    t.reset();
+    std::vector<triple> v = triples | view::take(max_triples);
+    std::cout << "to_vector:   " << t << " (" << accumulate(v, 0, plus{}, sum_triple) << ")\n";
+
+    // By hand:
+    t.reset();
+    result = 0;
+    int found = 0;
+    for(int z = 1;; ++z)
+    {
+        for(int x = 1; x <= z; ++x)
+        {
+            for(int y = x; y <= z; ++y)
+            {
+                if(x*x + y*y == z*z)
+                {
+                    result += (x + y + z);
+                    if(++found == max_triples)
+                        goto done;
+                }
+            }
+        }
+    }
+done:
+    std::cout << "hand-rolled: " << t << " (" << result << ")\n";
+}
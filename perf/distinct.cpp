@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares ways of removing the duplicates from unordered ids: sorting and
+// dropping adjacent duplicates, a std::unordered_set, and action::distinct,
+// which keeps the order and hashes integers in a flat open-addressing set.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <unordered_set>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+static constexpr int reps = 5;
+
+int main()
+{
+    std::mt19937_64 gen;
+    for(long long distinct_ids : {1000ll, 1000000ll})
+    {
+        // Random 62-bit ids, each appearing about as often as any other.
+        std::vector<long long> ids(static_cast<std::size_t>(distinct_ids));
+        for(auto &id : ids)
+            id = std::uniform_int_distribution<long long>(0, 1ll << 62)(gen);
+        std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+        std::vector<long long> data(10000000);
+        for(auto &i : data)
+            i = ids[pick(gen)];
+        std::cout << distinct_ids << " distinct ids in " << data.size() << ":\n";
+
+        std::size_t size = 0;
+        timer t;
+        for(int i = 0; i < reps; ++i)
+        {
+            std::vector<long long> v = data;
+            v |= action::sort | action::unique;
+            size += v.size();
+        }
+        std::cout << "  sort | unique:      " << t << " (" << size << ")\n";
+
+        size = 0;
+        t.reset();
+        for(int i = 0; i < reps; ++i)
+        {
+            std::vector<long long> v = data;
+            std::unordered_set<long long> seen;
+            v |= action::remove_if([&](long long id){ return !seen.insert(id).second; });
+            size += v.size();
+        }
+        std::cout << "  unordered_set:      " << t << " (" << size << ")\n";
+
+        size = 0;
+        t.reset();
+        for(int i = 0; i < reps; ++i)
+        {
+            std::vector<long long> v = data;
+            v |= action::distinct;
+            size += v.size();
+        }
+        std::cout << "  action::distinct:   " << t << " (" << size << ")\n";
+    }
+}
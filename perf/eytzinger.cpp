@@ -0,0 +1,85 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares searches of a sorted vector with ranges::lower_bound, one at a time,
+// with searches of an eytzinger_index of the same elements, one at a time and
+// in batches, for random keys, on arrays that fit in cache and ones that don't.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <range/v3/all.hpp>
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+int main()
+{
+    std::mt19937 gen;
+    for(std::size_t n : {1u << 12, 1u << 20, 1u << 25})
+    {
+        std::uniform_int_distribution<int> dist(0, 2 * static_cast<int>(n));
+        std::vector<int> v(n);
+        for(auto &i : v)
+            i = dist(gen);
+        v |= action::sort;
+        std::vector<int> probes(10000000);
+        for(auto &p : probes)
+            p = dist(gen);
+        std::cout << n << " elements, " << probes.size() << " searches:\n";
+
+        timer t;
+        eytzinger_index<int> idx{v};
+        std::cout << "  build:                    " << t << "\n";
+
+        std::size_t sum = 0;
+        t.reset();
+        for(auto p : probes)
+            sum += static_cast<std::size_t>(lower_bound(v, p) - v.begin());
+        std::cout << "  ranges::lower_bound:      " << t << " (" << sum << ")\n";
+
+        sum = 0;
+        t.reset();
+        for(auto p : probes)
+            sum += idx.lower_bound(p);
+        std::cout << "  eytzinger lower_bound:    " << t << " (" << sum << ")\n";
+
+        std::vector<std::size_t> res(probes.size());
+        t.reset();
+        idx.lower_bounds(probes, res.begin());
+        sum = accumulate(res, std::size_t(0));
+        std::cout << "  eytzinger lower_bounds:   " << t << " (" << sum << ")\n";
+    }
+}
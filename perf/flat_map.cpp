@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::map and flat_map, filled once and then probed many times:
+// filling each with a batch of keys, and looking up random keys that are
+// there about half the time.
+
+#include <map>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <range/v3/all.hpp>
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+using namespace ranges;
+
+int main()
+{
+    std::mt19937_64 gen;
+    for(std::size_t n : {1000u, 1000000u})
+    {
+        std::uniform_int_distribution<long long> dist(0, 2 * static_cast<long long>(n));
+        std::vector<std::pair<long long, long long>> rows(n);
+        for(auto &r : rows)
+            r = {dist(gen), dist(gen)};
+        std::vector<long long> probes(10000000);
+        for(auto &p : probes)
+            p = dist(gen);
+        std::cout << n << " keys, " << probes.size() << " lookups:\n";
+
+        timer t;
+        std::map<long long, long long> m;
+        for(auto const &r : rows)
+            m.insert(r);
+        std::cout << "  std::map fill:      " << t << "\n";
+        t.reset();
+        flat_map<long long, long long> fm;
+        fm.insert(rows);
+        std::cout << "  flat_map fill:      " << t << "\n";
+
+        long long sum = 0;
+        t.reset();
+        for(auto p : probes)
+        {
+            auto it = m.find(p);
+            if(it != m.end())
+                sum += it->second;
+        }
+        std::cout << "  std::map lookups:   " << t << " (" << sum << ")\n";
+
+        sum = 0;
+        t.reset();
+        for(auto p : probes)
+        {
+            auto it = fm.find(p);
+            if(it != fm.end())
+                sum += it->second;
+        }
+        std::cout << "  flat_map lookups:   " << t << " (" << sum << ")\n";
+    }
+}
@@ -0,0 +1,94 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares a chain of element-wise actions applied one at a time with the
+// same chain composed with `|`, which runs in a single pass.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+static constexpr int reps = 10;
+
+int main()
+{
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<int> data(20000000);
+    for(auto &i : data)
+        i = dist(gen);
+
+    auto scale = [](int i){ return i * 3 + 1; };
+    auto is_rare = [](int i){ return i % 64 == 0; };
+    auto small = [](int i){ return i < 4000; }; // Never stops early
+
+    std::size_t size = 0;
+    timer t;
+    for(int i = 0; i < reps; ++i)
+    {
+        std::vector<int> v = data;
+        v |= action::transform(scale);
+        v |= action::remove_if(is_rare);
+        v |= action::take_while(small);
+        v |= action::unique;
+        size += v.size();
+    }
+    std::cout << "one at a time: " << t << " (" << size << ")\n";
+
+    size = 0;
+    t.reset();
+    for(int i = 0; i < reps; ++i)
+    {
+        std::vector<int> v = data;
+        v |= action::transform(scale) | action::remove_if(is_rare) |
+            action::take_while(small) | action::unique;
+        size += v.size();
+    }
+    std::cout << "fused:         " << t << " (" << size << ")\n";
+
+    size = 0;
+    t.reset();
+    for(int i = 0; i < reps; ++i)
+    {
+        std::vector<int> v = data;
+        size += v.size();
+    }
+    std::cout << "(copy only:    " << t << ")\n";
+}
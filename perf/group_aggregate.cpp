@@ -0,0 +1,114 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares ways of summing amounts by id: sorting by id and summing each run,
+// a std::unordered_map, and group_aggregate, which hashes integer ids in a flat
+// open-addressing table, on one thread and split among several.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <unordered_map>
+#include <range/v3/all.hpp>
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+static constexpr int reps = 5;
+
+struct row
+{
+    long long id;
+    long long amount;
+};
+
+int main()
+{
+    std::mt19937_64 gen;
+    for(long long distinct_ids : {1000ll, 1000000ll})
+    {
+        // Random 62-bit ids, each appearing about as often as any other.
+        std::vector<long long> ids(static_cast<std::size_t>(distinct_ids));
+        for(auto &id : ids)
+            id = std::uniform_int_distribution<long long>(0, 1ll << 62)(gen);
+        std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+        std::vector<row> data(10000000);
+        for(auto &r : data)
+            r = row{ids[pick(gen)], static_cast<long long>(pick(gen) % 100)};
+        std::cout << distinct_ids << " distinct ids in " << data.size() << ":\n";
+
+        long long check = 0;
+        timer t;
+        for(int i = 0; i < reps; ++i)
+        {
+            std::vector<row> v = data;
+            v |= action::sort(less{}, &row::id);
+            std::vector<std::pair<long long, long long>> groups;
+            for(auto const &r : v)
+            {
+                if(groups.empty() || groups.back().first != r.id)
+                    groups.emplace_back(r.id, 0);
+                groups.back().second += r.amount;
+            }
+            check += static_cast<long long>(groups.size());
+        }
+        std::cout << "  sort + runs:            " << t << " (" << check << ")\n";
+
+        check = 0;
+        t.reset();
+        for(int i = 0; i < reps; ++i)
+        {
+            std::unordered_map<long long, long long> sums;
+            for(auto const &r : data)
+                sums[r.id] += r.amount;
+            check += static_cast<long long>(sums.size());
+        }
+        std::cout << "  unordered_map:          " << t << " (" << check << ")\n";
+
+        check = 0;
+        t.reset();
+        for(int i = 0; i < reps; ++i)
+            check += static_cast<long long>(
+                group_aggregate(data, &row::id, 0ll, plus{}, &row::amount).size());
+        std::cout << "  group_aggregate:        " << t << " (" << check << ")\n";
+
+        check = 0;
+        t.reset();
+        for(int i = 0; i < reps; ++i)
+            check += static_cast<long long>(
+                group_aggregate(par, data, &row::id, 0ll, plus{}, &row::amount).size());
+        std::cout << "  group_aggregate(par):   " << t << " (" << check << ")\n";
+    }
+}
@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares pulling the elements of a pipeline through its iterators with
+// pushing them through internal iteration (for_each_while), for each of the
+// common adaptors.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+static constexpr int reps = 20;
+
+template<typename Rng>
+long pull(Rng && rng)
+{
+    long sum = 0;
+    RANGES_FOR(auto &&i, rng)
+        sum += i;
+    return sum;
+}
+
+template<typename Rng>
+long push(Rng && rng)
+{
+    return accumulate(rng, 0L);
+}
+
+// Each repetition writes to an element of the underlying data, so that the
+// compiler cannot hoist the loop over the pipeline out of the repetitions.
+template<typename Rng>
+void run(char const *name, Rng && rng, int &touch)
+{
+    long result = 0;
+    timer t;
+    for(int i = 0; i < reps; ++i, ++touch)
+        result += pull(rng);
+    std::cout << name << " pull: " << t << " (" << result << ")\n";
+
+    touch -= reps;
+    result = 0;
+    t.reset();
+    for(int i = 0; i < reps; ++i, ++touch)
+        result += push(rng);
+    std::cout << name << " push: " << t << " (" << result << ")\n";
+    touch -= reps;
+}
+
+int main()
+{
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<int> v(10000000);
+    for(auto &i : v)
+        i = dist(gen);
+    std::vector<std::vector<int>> vv(v.size() / 10);
+    for(std::size_t i = 0; i < vv.size(); ++i)
+        vv[i].assign(v.begin() + (long)i * 10, v.begin() + ((long)i + 1) * 10);
+
+    auto is_even = [](int i){ return i % 2 == 0; };
+    auto square = [](int i){ return i * i; };
+
+    int k = 1;
+    auto times_k = [&k](int i){ return i * k; };
+    run("filter:          ", v | view::filter(is_even), v.back());
+    run("transform:       ", v | view::transform(square), v.back());
+    run("filter|transform:", v | view::filter(is_even) | view::transform(square), v.back());
+    run("join:            ", vv | view::join, vv.back().back());
+    run("join|filter:     ", vv | view::join | view::filter(is_even), vv.back().back());
+    run("iota|take:       ", view::ints(0) | view::transform(times_k) | view::take(10000000), k);
+}
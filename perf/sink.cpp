@@ -0,0 +1,85 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares writing numbers with ostream_iterator to writing them through an
+// ostream_sink, both into a string stream so that the disk doesn't come into it.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <sstream>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include <range/v3/utility/sink.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+template<typename T>
+void run(char const *name, std::vector<T> const &v)
+{
+    std::ostringstream a, b;
+    timer t;
+    copy(v, ostream_iterator<T>{a, "\n"});
+    std::cout << name << " ostream_iterator: " << t << " (" << a.tellp() << " bytes)\n";
+    t.reset();
+    {
+        ostream_sink sink(b, "\n");
+        copy(v, sink.out());
+    }
+    std::cout << name << " ostream_sink:     " << t << " (" << b.tellp() << " bytes)\n";
+    if(a.str() != b.str())
+        std::cout << "  outputs differ!\n";
+}
+
+int main()
+{
+    std::mt19937 gen;
+    std::vector<int> ints(10000000);
+    std::uniform_int_distribution<int> idist;
+    for(auto &i : ints)
+        i = idist(gen) - idist(gen);
+    std::vector<double> doubles(2000000);
+    std::uniform_real_distribution<double> ddist(-1000, 1000);
+    for(auto &d : doubles)
+        d = ddist(gen);
+    std::vector<double> whole(10000000);
+    for(auto &d : whole)
+        d = static_cast<double>(idist(gen) % 100000);
+
+    run("ints:   ", ints);
+    run("doubles:", doubles);
+    run("whole:  ", whole);
+}
@@ -0,0 +1,117 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares view::tokenize over std::regex with view::tokenize over a dfa_regex
+// on a synthetic web server log.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+using namespace ranges;
+
+static constexpr char const pattern[] = R"([0-9]+(\.[0-9]+)?|[A-Za-z_]+)";
+
+std::string make_log(std::size_t lines)
+{
+    static char const *const verbs[] = {"GET", "POST", "PUT", "DELETE"};
+    static char const *const paths[] = {"/index.html", "/api/v1/users", "/static/app.js",
+        "/images/logo.png", "/login"};
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 99999);
+    std::string log;
+    for(std::size_t i = 0; i < lines; ++i)
+    {
+        log += "10.0.";
+        log += std::to_string(dist(gen) % 256);
+        log += '.';
+        log += std::to_string(dist(gen) % 256);
+        log += " - - [10/Oct/2014:13:55:36] \"";
+        log += verbs[dist(gen) % 4];
+        log += ' ';
+        log += paths[dist(gen) % 5];
+        log += " HTTP/1.1\" ";
+        log += std::to_string(200 + dist(gen) % 300);
+        log += ' ';
+        log += std::to_string(dist(gen));
+        log += " 0.";
+        log += std::to_string(dist(gen) % 1000);
+        log += '\n';
+    }
+    return log;
+}
+
+template<typename Rng>
+void run(char const *name, Rng && tokens)
+{
+    timer t;
+    std::size_t count = 0, chars = 0;
+    for(auto &&tok : tokens)
+    {
+        ++count;
+        chars += static_cast<std::size_t>(tok.second - tok.first);
+    }
+    std::cout << name << t << " (" << count << " tokens, " << chars << " chars)\n";
+}
+
+int main()
+{
+    std::string const log = make_log(100000);
+    std::cout << "log: " << log.size() << " bytes\n";
+
+    timer t;
+    std::regex const rx{pattern};
+    std::cout << "std::regex compile: " << t << "\n";
+    t.reset();
+    dfa_regex const drx{pattern};
+    std::cout << "dfa_regex compile:  " << t << " (" << drx.states() << " states)\n";
+
+    run("std::regex tokenize: ", log | view::tokenize(rx));
+    run("dfa_regex tokenize:  ", log | view::tokenize(drx));
+
+    // A long text with no match, where each position starts a partial match that
+    // only fails at the end of the text.
+    for(std::size_t n : {10000u, 40000u, 1u << 24})
+    {
+        std::string const as(n, 'a');
+        dfa_regex const at{"[a-z]+@"};
+        std::cout << n << " chars, no match: ";
+        run("", as | view::tokenize(at));
+    }
+}
@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/action/shuffle.hpp>
+#include <range/v3/action/distinct.hpp>
+#include <range/v3/action/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct event
+{
+    int id;
+    std::string what;
+};
+
+struct string_length_hash
+{
+    std::size_t operator()(std::string const &s) const
+    {
+        return s.size();
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    // [1,2,2,3,3,3,4,4,4,4,5,5,5,5,5,...] in any order
+    std::vector<int> v =
+        view::for_each(view::ints(1,100), [](int i){
+            return yield_from(view::repeat_n(i,i));
+        });
+    v |= action::shuffle(gen);
+    std::vector<int> firsts;
+    {
+        std::vector<bool> seen(100);
+        for(int i : v)
+            if(!seen[i])
+            {
+                seen[i] = true;
+                firsts.push_back(i);
+            }
+    }
+    v |= action::distinct;
+    CHECK(v == firsts);
+    sort(v);
+    CHECK(equal(v, view::ints(1,100)));
+
+    // Zero and negative keys
+    std::vector<int> v2{0, -1, 0, 5, -1, 0, 5, 7};
+    action::distinct(v2);
+    ::check_equal(v2, {0, -1, 5, 7});
+
+    // With a projection, keeping the first of each.
+    std::vector<event> events{{3, "a"}, {1, "b"}, {3, "c"}, {2, "d"}, {1, "e"}};
+    events |= action::distinct(&event::id);
+    CHECK(events.size() == 3u);
+    CHECK(events[0].what == "a");
+    CHECK(events[1].what == "b");
+    CHECK(events[2].what == "d");
+
+    // Keys that aren't hashed flat, with a custom hash.
+    std::list<std::string> words{"b", "a", "bb", "b", "c", "bb"};
+    auto words2 = words;
+    words |= action::distinct(ident{}, string_length_hash{});
+    ::check_equal(words, {"b", "a", "bb", "c"});
+    words2 |= action::distinct;
+    ::check_equal(words2, {"b", "a", "bb", "c"});
+
+    // Fused with other element-wise actions.
+    std::vector<int> v3{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    v3 |= action::transform([](int i){ return i % 4; }) | action::distinct;
+    ::check_equal(v3, {1, 2, 3, 0});
+
+    return ::test_result();
+}
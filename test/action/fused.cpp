@@ -0,0 +1,163 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/action/drop_while.hpp>
+#include <range/v3/action/fused.hpp>
+#include <range/v3/action/remove_if.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/action/stride.hpp>
+#include <range/v3/action/take_while.hpp>
+#include <range/v3/action/transform.hpp>
+#include <range/v3/action/unique.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename T>
+struct is_fused
+  : std::false_type
+{};
+
+template<typename...Steps>
+struct is_fused<action::action<detail::fused_action<Steps...>>>
+  : std::true_type
+{};
+
+struct counted
+{
+    static int moves;
+    int i;
+    counted(int j = 0) : i(j) {}
+    counted(counted const &) = default;
+    counted(counted &&that) : i(that.i) { ++moves; }
+    counted &operator=(counted const &) = default;
+    counted &operator=(counted &&that) { i = that.i; ++moves; return *this; }
+    friend bool operator==(counted a, counted b) { return a.i == b.i; }
+    friend bool operator!=(counted a, counted b) { return a.i != b.i; }
+};
+int counted::moves = 0;
+
+struct no_default
+{
+    int i;
+    explicit no_default(int j) : i(j) {}
+};
+
+int main()
+{
+    auto half = [](int i) { return i / 2; };
+    auto is_odd = [](int i) { return i % 2 == 1; };
+    auto small = [](int i) { return i < 40; };
+    auto tiny = [](int i) { return i < 3; };
+
+    auto fused = action::transform(half) | action::remove_if(is_odd) | action::unique;
+    CHECK(is_fused<decltype(fused)>());
+    CHECK(is_fused<decltype(action::unique | action::stride(2))>());
+    CHECK(!is_fused<decltype(action::sort | action::unique)>());
+
+    // The fused actions do what the actions do one at a time.
+    std::mt19937 gen;
+    for(int n = 0; n < 200; ++n)
+    {
+        std::vector<int> v(static_cast<std::size_t>(n));
+        for(auto &i : v)
+            i = static_cast<int>(gen() % 50);
+
+        std::vector<int> a = v, b = v;
+        a |= fused;
+        b |= action::transform(half);
+        b |= action::remove_if(is_odd);
+        b |= action::unique;
+        CHECK(a == b);
+
+        a = v, b = v;
+        a |= action::drop_while(tiny) | action::stride(3) | action::take_while(small) |
+            action::unique(std::equal_to<int>{}, half);
+        b |= action::drop_while(tiny);
+        b |= action::stride(3);
+        b |= action::take_while(small);
+        b |= action::unique(std::equal_to<int>{}, half);
+        CHECK(a == b);
+
+        // unique, then a step that drops what unique let through.
+        a = v, b = v;
+        a |= action::unique | action::remove_if(is_odd) | action::unique;
+        b |= action::unique;
+        b |= action::remove_if(is_odd);
+        b |= action::unique;
+        CHECK(a == b);
+
+        // unique, then a step that changes what unique let through.
+        a = v, b = v;
+        a |= action::unique | action::transform(half) | action::unique;
+        b |= action::unique;
+        b |= action::transform(half);
+        b |= action::unique;
+        CHECK(a == b);
+    }
+
+    {
+        std::list<int> l = {1, 2, 3, 4, 5, 6, 7, 8};
+        l = std::move(l) | (action::remove_if(is_odd) | action::transform(half));
+        check_equal(l, {1, 2, 3, 4});
+    }
+
+    {
+        // Ranges that can't be erased from are processed one action at a time.
+        std::array<int, 4> a = {{1, 2, 3, 4}};
+        a |= action::transform(half) | action::transform([](int i) { return i * 3; });
+        check_equal(a, {0, 3, 3, 6});
+    }
+
+    {
+        // One pass: each surviving element is moved at most once.
+        std::vector<counted> v;
+        for(int i = 0; i < 1000; ++i)
+            v.push_back(i % 7);
+        counted::moves = 0;
+        v |= action::remove_if([](counted c) { return c.i == 0; }) | action::stride(2) |
+            action::unique;
+        CHECK(counted::moves <= 1000);
+        CHECK(v.size() == 429u);
+    }
+
+    {
+        // Move-only elements.
+        std::vector<std::unique_ptr<int>> v;
+        for(int i : {1, 1, 2, 3, 3, 3, 4, 5, 5})
+            v.emplace_back(new int(i));
+        auto deref = [](std::unique_ptr<int> const &p) { return *p; };
+        v |= action::remove_if([](std::unique_ptr<int> const &p) { return *p == 4; }) |
+            action::unique(std::equal_to<int>{}, deref);
+        CHECK(v.size() == 4u);
+        check_equal(v | view::transform(deref), {1, 2, 3, 5});
+    }
+
+    {
+        // Elements that can't be default constructed.
+        std::vector<no_default> v;
+        for(int i : {1, 1, 2, 2, 3, 4, 4, 7})
+            v.emplace_back(i);
+        v |= action::remove_if([](no_default const &n) { return n.i == 3; }) |
+            action::unique(std::equal_to<int>{}, &no_default::i) | action::stride(2);
+        CHECK(v.size() == 2u);
+        check_equal(v | view::transform(&no_default::i), {1, 4});
+    }
+
+    return ::test_result();
+}
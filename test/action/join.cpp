@@ -0,0 +1,52 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include <range/v3/core.hpp>
+#include <range/v3/action/join.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::vector<int>> vv{{1, 2}, {}, {3}, {4, 5, 6}};
+    auto v = action::join(vv);
+    static_assert(std::is_same<decltype(v), std::vector<int>>::value, "");
+    ::check_equal(v, {1, 2, 3, 4, 5, 6});
+    // The inner sizes are summed, so there's a single allocation.
+    CHECK(v.capacity() == 6u);
+
+    std::list<std::string> ls{"hello", ", ", "world"};
+    auto s = action::join(ls);
+    static_assert(std::is_same<decltype(s), std::string>::value, "");
+    CHECK(s == "hello, world");
+
+    // Inner ranges computed on the fly are only visited once.
+    int calls = 0;
+    auto v3 = view::ints(1) | view::take(4) |
+        view::transform([&](int i){ ++calls; return std::vector<int>(i, i); }) |
+        action::join;
+    CHECK(calls == 4);
+    ::check_equal(v3, {1, 2, 2, 3, 3, 3, 4, 4, 4, 4});
+
+    auto v2 = std::move(vv) | action::join;
+    ::check_equal(v2, {1, 2, 3, 4, 5, 6});
+
+    return ::test_result();
+}
@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/eytzinger_index.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // Every size up to a few full trees, with duplicates, against std::lower_bound
+    // and friends, for keys in and between and around the elements.
+    for(int n = 0; n < 70; ++n)
+    {
+        std::vector<int> v = view::ints(0, n) | view::transform([](int i) { return 2 * (i / 2); });
+        eytzinger_index<int> idx{v};
+        CHECK(idx.size() == static_cast<std::size_t>(n));
+        CHECK(idx.empty() == (n == 0));
+        for(int i = 0; i < n; ++i)
+            CHECK(idx[static_cast<std::size_t>(i)] == v[static_cast<std::size_t>(i)]);
+        std::vector<int> keys = view::ints(-2, n + 3);
+        std::vector<std::size_t> batch;
+        idx.lower_bounds(keys, ranges::back_inserter(batch));
+        CHECK(batch.size() == keys.size());
+        for(std::size_t i = 0; i < keys.size(); ++i)
+        {
+            int const key = keys[i];
+            auto const lo = static_cast<std::size_t>(
+                std::lower_bound(v.begin(), v.end(), key) - v.begin());
+            auto const hi = static_cast<std::size_t>(
+                std::upper_bound(v.begin(), v.end(), key) - v.begin());
+            CHECK(idx.lower_bound(key) == lo);
+            CHECK(idx.upper_bound(key) == hi);
+            CHECK(idx.equal_range(key) == std::make_pair(lo, hi));
+            CHECK(idx.binary_search(key) == std::binary_search(v.begin(), v.end(), key));
+            CHECK(batch[i] == lo);
+        }
+    }
+
+    // Another order, keys of another type, and a range with no size.
+    {
+        std::vector<std::string> words{"kiwi", "fig", "date", "cherry", "banana", "apple"};
+        auto idx = make_eytzinger_index(words | view::filter([](std::string const &s) {
+            return s != "date";
+        }), std::greater<std::string>{});
+        CHECK(idx.size() == 5u);
+        CHECK(idx[0] == "kiwi");
+        CHECK(idx[4] == "apple");
+        CHECK(idx.lower_bound(std::string("date")) == 2u);
+        CHECK(idx.binary_search(std::string("fig")));
+        CHECK(!idx.binary_search(std::string("date")));
+        CHECK(idx.upper_bound(std::string("apple")) == 5u);
+        CHECK(idx.lower_bound(std::string("zucchini")) == 0u);
+    }
+
+    // A batch lookup of many keys, larger than one batch.
+    {
+        std::vector<long> v = view::ints(0, 1000) | view::transform([](int i) { return 3l * i; });
+        auto idx = make_eytzinger_index(v);
+        std::vector<long> keys = view::ints(0, 100) | view::transform([](int i) {
+            return (i * 7919l) % 3100 - 50;
+        });
+        std::vector<std::size_t> res(keys.size());
+        CHECK(idx.lower_bounds(keys, res.begin()) == res.end());
+        for(std::size_t i = 0; i < keys.size(); ++i)
+            CHECK(res[i] == idx.lower_bound(keys[i]));
+    }
+
+    // The tree starts on a cache line, with the root second, in copies too.
+    {
+        auto idx = make_eytzinger_index(view::ints(0, 15));
+        auto copy = idx;
+        CHECK((reinterpret_cast<std::uintptr_t>(&idx[7]) % 64) == sizeof(int));
+        CHECK((reinterpret_cast<std::uintptr_t>(&copy[7]) % 64) == sizeof(int));
+        CHECK(copy[7] == 7);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,99 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/flat_map.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/view/map.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/iota.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, std::string>;
+
+    flat_map<int, std::string> m{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+    ::models<concepts::RandomAccessRange>(m);
+    ::models_not<concepts::View>(m);
+    ::check_equal(m, std::vector<P>{{1, "a"}, {2, "b"}, {3, "c"}});
+
+    // view::keys and view::values.
+    ::check_equal(m | view::keys, {1, 2, 3});
+    ::check_equal(m | view::values, std::vector<std::string>{"a", "b", "c"});
+
+    // Lookups and subscripts.
+    CHECK(m.find(2)->second == "b");
+    CHECK(m.find(4) == m.end());
+    CHECK(m.contains(3));
+    CHECK(m.at(1) == "a");
+    bool thrown = false;
+    try
+    {
+        m.at(4);
+    }
+    catch(std::out_of_range const &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    m[2] = "B";
+    m[0] += "z";
+    ::check_equal(m, std::vector<P>{{0, "z"}, {1, "a"}, {2, "B"}, {3, "c"}});
+    auto const &cm = m;
+    CHECK(cm.at(0) == "z");
+    CHECK(cm.lower_bound(2)->second == "B");
+
+    // Values can be changed through iterators.
+    m.begin()->second = "y";
+    CHECK(m[0] == "y");
+
+    // Inserting, one at a time and in bulk; existing keys keep their values.
+    CHECK(!m.insert(P{1, "q"}).second);
+    CHECK(m.emplace(5, "e").second);
+    m.insert(std::vector<P>{{4, "d"}, {2, "?"}, {4, "?"}, {7, "g"}});
+    ::check_equal(m | view::keys, {0, 1, 2, 3, 4, 5, 7});
+    ::check_equal(m | view::values,
+        std::vector<std::string>{"y", "a", "B", "c", "d", "e", "g"});
+    std::vector<std::string> more{"f", "?", "h"};
+    action::insert(m, view::zip(view::ints(6, 9), more));
+    ::check_equal(m | view::keys, {0, 1, 2, 3, 4, 5, 6, 7, 8});
+    CHECK(m[7] == "g");
+    CHECK(m.erase(3) == 1u);
+    CHECK(!m.contains(3));
+
+    // Building one from a std::map, and back.
+    std::map<int, std::string> sm{{2, "two"}, {1, "one"}};
+    flat_map<int, std::string> fm{sm};
+    ::check_equal(fm, std::vector<P>{{1, "one"}, {2, "two"}});
+    CHECK((fm | to_<std::map<int, std::string>>()) == sm);
+
+    // Many keys.
+    flat_map<int, int> big;
+    for(int i = 0; i < 1000; ++i)
+        big[(i * 7919) % 1000] = i;
+    CHECK(big.size() == 1000u);
+    int prev = -1;
+    for(auto const &p : big)
+    {
+        CHECK(p.first == prev + 1);
+        prev = p.first;
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,119 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/flat_set.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    flat_set<int> s{5, 1, 4, 1, 5, 9, 2, 6};
+    ::models<concepts::RandomAccessRange>(s);
+    ::models<concepts::SizedRange>(s);
+    ::models_not<concepts::View>(s);
+    ::check_equal(s, {1, 2, 4, 5, 6, 9});
+    CHECK(s.size() == 6u);
+
+    // Lookups.
+    CHECK(s.contains(4));
+    CHECK(!s.contains(3));
+    CHECK(s.count(5) == 1u);
+    CHECK(s.count(7) == 0u);
+    CHECK(*s.find(6) == 6);
+    CHECK(s.find(7) == s.end());
+    CHECK(*s.lower_bound(3) == 4);
+    CHECK(*s.upper_bound(4) == 5);
+    CHECK((s.equal_range(5).second - s.equal_range(5).first) == 1);
+    CHECK(s.equal_range(3).first == s.equal_range(3).second);
+
+    // Single inserts, with and without hints.
+    CHECK(s.insert(3).second);
+    CHECK(!s.insert(3).second);
+    CHECK(*s.insert(7).first == 7);
+    CHECK(*s.insert(s.end(), 10) == 10);
+    CHECK(*s.insert(s.begin(), 8) == 8); // a wrong hint is ignored
+    CHECK(*s.insert(s.begin(), 0) == 0);
+    CHECK(s.emplace(11).second);
+    ::check_equal(s, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+    // Erasing.
+    CHECK(s.erase(5) == 1u);
+    CHECK(s.erase(5) == 0u);
+    s.erase(s.begin());
+    s.erase(s.find(9), s.end());
+    ::check_equal(s, {1, 2, 3, 4, 6, 7, 8});
+
+    // Bulk inserts: overlapping, after the end, and into an empty set.
+    s.insert(std::vector<int>{20, 3, 0, 20, 5, 15});
+    ::check_equal(s, {0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 20});
+    s.insert(view::ints(30, 33));
+    ::check_equal(s, {0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 20, 30, 31, 32});
+    flat_set<int> e;
+    std::list<int> l{3, 2, 3, 1};
+    e.insert(l.begin(), l.end());
+    ::check_equal(e, {1, 2, 3});
+    e.insert({4, 0});
+    ::check_equal(e, {0, 1, 2, 3, 4});
+
+    // action::insert.
+    action::insert(e, view::ints(3, 7));
+    ::check_equal(e, {0, 1, 2, 3, 4, 5, 6});
+    action::insert(e, -1);
+    CHECK(*e.begin() == -1);
+
+    // Constructing from ranges, and another order.
+    flat_set<int, std::greater<int>> g{view::ints(0, 5) | view::transform([](int i) {
+        return i % 3;
+    })};
+    ::check_equal(g, {2, 1, 0});
+    CHECK(*g.lower_bound(1) == 1);
+    ::check_equal(g | view::reverse, {0, 1, 2});
+
+    // The first of equivalent keys is the one kept.
+    struct by_size
+    {
+        bool operator()(std::string const &a, std::string const &b) const
+        {
+            return a.size() < b.size();
+        }
+    };
+    flat_set<std::string, by_size> w{"bb", "a", "cc", "d", "eee"};
+    ::check_equal(w, std::vector<std::string>{"a", "bb", "eee"});
+    w.insert(std::vector<std::string>{"ff", "gggg", "h"});
+    ::check_equal(w, std::vector<std::string>{"a", "bb", "eee", "gggg"});
+    w.insert(std::string("iiiii"));
+    CHECK(w.size() == 5u);
+
+    // Copies and comparisons.
+    flat_set<int> c = e;
+    CHECK(c == e);
+    c.insert(100);
+    CHECK(c != e);
+    CHECK(e < c);
+    swap(c, e);
+    CHECK(e.contains(100));
+    CHECK(!c.contains(100));
+    c.clear();
+    CHECK(c.empty());
+
+    return ::test_result();
+}
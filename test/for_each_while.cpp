@@ -0,0 +1,159 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <tuple>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_exactly.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct collect
+{
+    std::vector<int> &out;
+    int limit;
+    bool operator()(int i) const
+    {
+        out.push_back(i);
+        return (int)out.size() != limit;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    // Internal iteration is provided by the views and falls back to iterators
+    // for everything else.
+    {
+        using I = decltype(view::iota(0, 10));
+        using T = decltype(view::iota(0, 10) | view::transform(std::negate<int>()));
+        using L = std::list<int>;
+        CONCEPT_ASSERT(HasForEachWhile<I, collect>());
+        CONCEPT_ASSERT(HasForEachWhile<T, collect>());
+        CONCEPT_ASSERT(!HasForEachWhile<L, collect>());
+
+        std::vector<int> out;
+        CHECK(for_each_while(view::iota(0, 10), collect{out, -1}));
+        check_equal(out, {0,1,2,3,4,5,6,7,8,9});
+
+        out.clear();
+        CHECK(!for_each_while(view::ints(0), collect{out, 3}));
+        check_equal(out, {0,1,2});
+
+        out.clear();
+        CHECK(!for_each_while(L{4,5,6}, collect{out, 2}));
+        check_equal(out, {4,5});
+
+        out.clear();
+        CHECK(for_each_while(view::closed_iota(3, 5), collect{out, -1}));
+        check_equal(out, {3,4,5});
+    }
+
+    // take stops the base range once it has enough elements, without asking for
+    // one more.
+    {
+        int calls = 0;
+        auto rng = view::ints(0) | view::transform([&](int i){ return ++calls, i * i; });
+        std::vector<int> out;
+        CHECK(for_each_while(rng | view::take(4), collect{out, -1}));
+        check_equal(out, {0,1,4,9});
+        CHECK(calls == 4);
+
+        out.clear();
+        calls = 0;
+        CHECK(!for_each_while(rng | view::take_exactly(4), collect{out, 2}));
+        check_equal(out, {0,1});
+        CHECK(calls == 2);
+
+        out.clear();
+        CHECK(for_each_while(rng | view::take(0), collect{out, -1}));
+        CHECK(out.empty());
+    }
+
+    // Comprehensions run as nested loops.
+    {
+        auto triples =
+            view::for_each(view::ints(1), [](int z)
+            {
+                return view::for_each(view::ints(1, z+1), [=](int x)
+                {
+                    return view::for_each(view::ints(x, z+1), [=](int y)
+                    {
+                        return yield_if(x*x + y*y == z*z, std::make_tuple(x, y, z));
+                    });
+                });
+            });
+        auto sum = [](std::tuple<int, int, int> t)
+        {
+            return std::get<0>(t) + std::get<1>(t) + std::get<2>(t);
+        };
+        CHECK(accumulate(triples | view::take(10), 0, plus{}, sum) == 12+24+30+36+40+48+60+56+60+70);
+
+        std::vector<std::tuple<int, int, int>> v = triples | view::take(3);
+        CHECK(v.size() == 3u);
+        CHECK(v[0] == std::make_tuple(3, 4, 5));
+        CHECK(v[1] == std::make_tuple(6, 8, 10));
+        CHECK(v[2] == std::make_tuple(5, 12, 13));
+
+        int count = 0;
+        for_each(triples | view::take(5), [&](std::tuple<int, int, int>){ ++count; });
+        CHECK(count == 5);
+    }
+
+    // Joins of sized ranges push too.
+    {
+        std::vector<std::vector<int>> vvi{{0,1}, {}, {2}, {3,4,5}};
+        std::vector<int> out;
+        CHECK(!for_each_while(vvi | view::join, collect{out, 4}));
+        check_equal(out, {0,1,2,3});
+        CHECK(accumulate(view::repeat_n(view::iota(1, 4), 3) | view::join, 0) == 18);
+    }
+
+    // Filters drop elements on the way to the sink.
+    {
+        auto is_odd = [](int i){ return i % 2 == 1; };
+        auto evens = view::iota(0, 10) | view::remove_if(is_odd);
+        CONCEPT_ASSERT(HasForEachWhile<decltype(evens), collect>());
+        std::vector<int> out;
+        CHECK(for_each_while(evens, collect{out, -1}));
+        check_equal(out, {0,2,4,6,8});
+
+        out.clear();
+        CHECK(!for_each_while(view::ints(0) | view::filter(is_odd), collect{out, 3}));
+        check_equal(out, {1,3,5});
+
+        CHECK(count_if(view::iota(0, 100) | view::filter(is_odd),
+            [](int i){ return i % 3 == 0; }) == 17);
+
+        std::vector<std::vector<int>> vvi{{1,2,3}, {}, {4,5}};
+        int buf[5] = {};
+        auto res = copy(vvi | view::join | view::transform([](int i){ return i * 10; }), buf);
+        CHECK(res.second == buf + 5);
+        check_equal(buf, {10,20,30,40,50});
+    }
+
+    return ::test_result();
+}
@@ -9,6 +9,8 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <string>
+#include <vector>
 #include <sstream>
 #include <range/v3/core.hpp>
 #include "./simple_test.hpp"
@@ -29,5 +31,37 @@ good men
     CONCEPT_ASSERT(ranges::InputView<Rng>());
     CONCEPT_ASSERT(!ranges::ForwardView<Rng>());
 
+    // Lines of a buffer in memory are pointer ranges into the buffer.
+    {
+        using namespace ranges;
+        auto to_string = [](range<char const *> line)
+        {
+            return std::string(line.begin(), line.end());
+        };
+        std::string const buf{"Now is\r\nthe time\n\nfor all\r\ngood men"};
+        auto lines = getlines(buf);
+        using Lines = decltype(lines);
+        ::models<concepts::BoundedView>(lines);
+        ::models<concepts::ForwardView>(lines);
+        ::has_type<range<char const *>>(*begin(lines));
+        CHECK((*begin(lines)).begin() == buf.data());
+        std::vector<std::string> v;
+        for(auto line : lines)
+            v.push_back(to_string(line));
+        ::check_equal(v, {"Now is", "the time", "", "for all", "good men"});
+        range<char const *> rng{buf.data(), buf.data() + buf.size()};
+        CONCEPT_ASSERT(Same<Lines, decltype(getlines(rng))>());
+
+        v.clear();
+        std::vector<char> const csv{'a', ';', 'b', '\r', ';', ';'};
+        for(auto field : getlines(csv, ';'))
+            v.push_back(to_string(field));
+        ::check_equal(v, {"a", "b\r", ""});
+
+        std::string const empty, nl{"\n"};
+        CHECK(ranges::distance(getlines(empty)) == 0);
+        CHECK(ranges::distance(getlines(nl)) == 1);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,143 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <list>
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/group_aggregate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/filter.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct sale
+{
+    std::string region;
+    int amount;
+};
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, int>;
+    auto mod3 = [](int i) { return i % 3; };
+
+    // Groups come in the order their keys are first seen.
+    {
+        std::vector<int> v{5, 1, 4, 2, 3, 7, 0};
+        auto res = group_aggregate(v, mod3, 0);
+        ::check_equal(res, std::vector<P>{{2, 5+2}, {1, 1+4+7}, {0, 3+0}});
+        CHECK(group_aggregate(std::vector<int>{}, mod3, 0).empty());
+    }
+
+    // With an operation and a projection, on a range that isn't random access.
+    {
+        std::list<sale> sales{{"north", 10}, {"south", 3}, {"north", 5}, {"east", 1},
+            {"south", 4}};
+        auto res = group_aggregate(sales, &sale::region, 1, multiplies{}, &sale::amount);
+        ::check_equal(res, std::vector<std::pair<std::string, int>>{
+            {"north", 50}, {"south", 12}, {"east", 1}});
+    }
+
+    // The accumulator needn't be the element type.
+    {
+        std::vector<int> v{3, 1, 4, 1, 5, 9, 2, 6};
+        auto res = group_aggregate(v, [](int i) { return i % 2 == 0; }, std::string{},
+            [](std::string s, int i) { return s += char('0' + i); });
+        CHECK(res.size() == 2u);
+        CHECK(res[0].first == false);
+        CHECK(res[0].second == "31159");
+        CHECK(res[1].first == true);
+        CHECK(res[1].second == "426");
+    }
+
+    // Views work too, and are iterated internally.
+    {
+        auto res = group_aggregate(view::ints(0, 20) | view::filter([](int i) { return i % 2; }),
+            mod3, 0);
+        ::check_equal(res, std::vector<P>{{1, 1+7+13+19}, {0, 3+9+15}, {2, 5+11+17}});
+    }
+
+    // In parallel, the result is the same as in one pass.
+    {
+        std::vector<int> v;
+        for(int i = 0; i < 200000; ++i)
+            v.push_back((i * 7919) % 1013);
+        auto key = [](int i) { return i % 101; };
+        auto seq = group_aggregate(v, key, 0);
+        auto par4 = group_aggregate(parallel_t{4}, v, key, 0);
+        CHECK(par4 == seq);
+        CHECK(group_aggregate(par, v, key, 0) == seq);
+
+        // Counting elements: the slices' counts are merged by adding them.
+        auto counts = group_aggregate(parallel_t{4}, v, key, 0,
+            [](int n, int) { return n + 1; }, ident{}, plus{});
+        CHECK(counts.size() == seq.size());
+        int total = 0;
+        for(auto const &g : counts)
+            total += g.second;
+        CHECK(total == 200000);
+        CHECK(counts == group_aggregate(v, key, 0, [](int n, int) { return n + 1; }));
+
+        // An init that isn't an identity is counted once, with the slices starting
+        // from one that is.
+        std::vector<int> ones(200000, 1);
+        auto const zero = [](int) { return 0; };
+        auto const once = group_aggregate(ones, zero, 100);
+        CHECK(once == (std::vector<P>{{0, 200100}}));
+        CHECK(group_aggregate(parallel_t{4}, ones, zero, 100, plus{}, ident{}, plus{}, 0) ==
+            once);
+        // A key first seen in a later slice.
+        std::vector<int> halves(200000, 1);
+        std::fill(halves.begin() + 150000, halves.end(), 2);
+        auto const split = group_aggregate(halves, ident{}, 100);
+        CHECK(split == (std::vector<P>{{1, 150100}, {2, 100100}}));
+        CHECK(group_aggregate(parallel_t{4}, halves, ident{}, 100, plus{}, ident{}, plus{},
+            0) == split);
+
+        // Too few elements to split.
+        std::vector<int> small{1, 2, 3, 4};
+        ::check_equal(group_aggregate(parallel_t{4}, small, mod3, 0),
+            std::vector<P>{{1, 1+4}, {2, 2}, {0, 3}});
+
+        // Ranges that can't be split are aggregated on the calling thread.
+        std::list<int> l{1, 2, 3, 4};
+        ::check_equal(group_aggregate(par, l, mod3, 0),
+            std::vector<P>{{1, 1+4}, {2, 2}, {0, 3}});
+    }
+
+    // An exception on any thread reaches the caller.
+    {
+        std::vector<int> v(100000, 1);
+        v[70000] = -1;
+        bool thrown = false;
+        try
+        {
+            group_aggregate(parallel_t{4}, v, mod3, 0, [](int acc, int i)
+            {
+                if(i < 0)
+                    throw std::runtime_error("negative");
+                return acc + i;
+            });
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return ::test_result();
+}
@@ -10,12 +10,17 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <list>
+#include <memory>
+#include <string>
+#include <stdexcept>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/to_container.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/take.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/join.hpp>
 #include <range/v3/action/sort.hpp>
 #include "./simple_test.hpp"
 #include "./test_utils.hpp"
@@ -36,6 +41,30 @@ struct vector_like : std::vector<T> {
     }
 };
 
+// Counts the allocations made through it and its rebound copies.
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    int *count_;
+    explicit counting_allocator(int &count) : count_(&count) {}
+    template<typename U>
+    counting_allocator(counting_allocator<U> const &that) : count_(that.count_) {}
+    T *allocate(std::size_t n)
+    {
+        ++*count_;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    bool operator==(counting_allocator<U> const &that) const { return count_ == that.count_; }
+    template<typename U>
+    bool operator!=(counting_allocator<U> const &that) const { return count_ != that.count_; }
+};
+
 int main()
 {
     using namespace ranges;
@@ -61,5 +90,134 @@ int main()
     CHECK(vl.reservation_count == std::size_t{1});
     CHECK(vl.last_reservation == N);
 
+    auto even = [](int i){ return i % 2 == 0; };
+    auto evens = view::iota(0, int{N}) | view::filter(even);
+    auto vl1 = evens | to_<vector_like<int>>()(count_first);
+    CHECK(vl1.reservation_count == std::size_t{1});
+    CHECK(vl1.last_reservation == N / 2);
+    CHECK(vl1.size() == N / 2);
+    CHECK(vl1.back() == int{N} - 2);
+
+    auto vl2 = to_<vector_like<int>>()(evens, size_hint(N));
+    CHECK(vl2.reservation_count == std::size_t{1});
+    CHECK(vl2.last_reservation == N);
+    CHECK(vl2.size() == N / 2);
+
+    auto vec2 = evens | to_vector(size_hint(10));
+    CHECK(vec2.size() == N / 2);
+    CHECK(vec2.capacity() >= N / 2);
+    auto vec3 = to_vector(evens, count_first);
+    CHECK(vec3.capacity() == N / 2);
+    ::check_equal(vec3, vec2);
+
+    // A sized range ignores the hint.
+    auto vl3 = view::iota(0, 10) | to_<vector_like<int>>()(size_hint(N));
+    CHECK(vl3.last_reservation == std::size_t{10});
+
+    // The inner ranges of a join are summed.
+    std::vector<std::vector<int>> vv{{1, 2}, {}, {3, 4, 5}};
+    auto vl4 = vv | view::join | to_<vector_like<int>>();
+    CHECK(vl4.reservation_count == std::size_t{1});
+    CHECK(vl4.last_reservation == std::size_t{5});
+    ::check_equal(vl4, {1, 2, 3, 4, 5});
+
+    // A container that can't reserve ignores the hint.
+    auto lst1 = evens | view::take(3) | to_<std::list>()(size_hint(N));
+    ::check_equal(lst1, {0, 2, 4});
+
+    {
+        // Refilling an existing container reuses its memory.
+        std::vector<int> out;
+        assign_to(view::iota(0, 100), out);
+        ::check_equal(out, view::iota(0, 100));
+        int const *const data = out.data();
+        for(int i = 0; i < 10; ++i)
+        {
+            auto &res = view::iota(i, i + 90 + i) | to_(out);
+            CHECK(&res == &out);
+            CHECK(out.size() == std::size_t(90 + i));
+            CHECK(out.front() == i);
+        }
+        evens | view::take(50) | to_(out);
+        ::check_equal(out, view::iota(0, 100) | view::filter(even));
+        CHECK(out.data() == data);
+
+        vector_like<int> vl5;
+        assign_to(view::iota(0, 10), vl5);
+        assign_to(view::iota(0, 5), vl5);
+        CHECK(vl5.reservation_count == std::size_t{2});
+        CHECK(vl5.capacity() == std::size_t{10});
+        ::check_equal(vl5, {0, 1, 2, 3, 4});
+
+        std::list<int> lst2{9, 9};
+        evens | view::take(3) | to_(lst2);
+        ::check_equal(lst2, {0, 2, 4});
+    }
+
+    {
+        int count = 0;
+        auto vec4 = view::iota(0, 1000) | to_<std::vector>(counting_allocator<char>{count});
+        static_assert((bool)Same<decltype(vec4), std::vector<int, counting_allocator<int>>>(), "");
+        CHECK(count == 1);
+        CHECK(vec4.get_allocator().count_ == &count);
+        CHECK(vec4.size() == 1000u);
+        view::iota(0, 500) | to_(vec4);
+        CHECK(count == 1);
+        auto lst3 = view::iota(0, 3) | to_<std::list>(counting_allocator<int>{count});
+        ::check_equal(lst3, {0, 1, 2});
+        CHECK(count == 4);
+
+        auto vec5 = view::iota(0, 3) | to_<std::vector, std::allocator<void>>();
+        static_assert((bool)Same<decltype(vec5), std::vector<int>>(), "");
+
+        // An explicit container type still copies, rather than filling its argument.
+        std::vector<int> src{1, 2, 3};
+        auto vec6 = to_<std::vector<int>>(src);
+        vec6.push_back(4);
+        CHECK(src.size() == 3u);
+    }
+
+    {
+        // Filled in slices from several threads.
+        auto sq = view::iota(0, 100000) | view::transform([](int i){ return i * 3 + 1; });
+        auto vec7 = sq | to_vector(par);
+        static_assert((bool)Same<decltype(vec7), std::vector<int>>(), "");
+        ::check_equal(vec7, sq);
+        auto vec8 = to_<std::vector<long>>()(sq, parallel_t{5});
+        ::check_equal(vec8, sq);
+        auto vec9 = view::iota(0, 10) | to_vector(parallel_t{8});
+        ::check_equal(vec9, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        auto bits = view::iota(0, 100000) | view::transform([](int i){ return i % 3 == 0; })
+            | to_<std::vector<bool>>()(par);
+        CHECK(bits.size() == 100000u);
+        CHECK((bits[99999] && !bits[99998]));
+        auto lst4 = evens | to_<std::list>()(par);
+        CHECK(lst4.size() == N / 2);
+        // Hints aren't taken for allocators.
+        auto vec10 = sq | to_<std::vector>(par);
+        static_assert((bool)Same<decltype(vec10), std::vector<int>>(), "");
+        ::check_equal(vec10, sq);
+        auto lst5 = evens | view::take(3) | to_<std::list>(size_hint(3));
+        ::check_equal(lst5, {0, 2, 4});
+        auto vec11 = evens | to_<std::vector>(count_first);
+        CHECK(vec11.size() == N / 2);
+
+        bool thrown = false;
+        try
+        {
+            auto bad = view::iota(0, 100000) | view::transform([](int i){
+                if(i == 77777)
+                    throw std::runtime_error("bad element");
+                return i;
+            }) | to_vector(parallel_t{4});
+            CHECK(false);
+        }
+        catch(std::runtime_error const &e)
+        {
+            thrown = std::string{"bad element"} == e.what();
+        }
+        CHECK(thrown);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,119 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/sink.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+// The sink writes what an ostream with default flags writes.
+template<typename T>
+void check_like_ostream(std::vector<T> const &v)
+{
+    std::ostringstream expected, actual;
+    std::copy(v.begin(), v.end(), std::ostream_iterator<T>(expected, ","));
+    {
+        ostream_sink sink(actual, ",", 16);
+        copy(v, sink.out());
+    }
+    CHECK(actual.str() == expected.str());
+}
+
+int main()
+{
+    ::models<concepts::WeakOutputIterator>(ostream_sink(std::cout).out(), 42);
+    ::models<concepts::WeakOutputIterator>(ostream_sink(std::cout).out(), 4.2);
+    ::models<concepts::WeakOutputIterator>(ostream_sink(std::cout).out(), std::string());
+    ::models_not<concepts::WeakOutputIterator>(ostream_sink(std::cout).out(), std::vector<int>());
+
+    check_like_ostream<int>({0, 1, -1, 9, 10, 99, 100, -100, 12345, 1000000,
+        std::numeric_limits<int>::min(), std::numeric_limits<int>::max()});
+    check_like_ostream<long long>({std::numeric_limits<long long>::min(),
+        std::numeric_limits<long long>::max()});
+    check_like_ostream<unsigned long long>({0, 42, std::numeric_limits<unsigned long long>::max()});
+    check_like_ostream<short>({-32768, 32767});
+    check_like_ostream<double>({0.0, -0.0, 1.0, -1.0, 0.5, 3.25, 1.0 / 3, 100000.0, 999999.0,
+        1000000.0, 1234567.0, 1e-5, 1e100, -2.5e-300, 123456.5, 999999.5, 0.000123456789,
+        -0.0001, 9.9999996, 1234.5678, 0.1 + 0.2,
+        std::numeric_limits<double>::infinity(), std::numeric_limits<double>::max()});
+    check_like_ostream<float>({0.1f, 1.5f, 16777216.0f});
+    check_like_ostream<long double>({0.0L, -1.5L, 1.0L / 3,
+        std::numeric_limits<long double>::max()});
+    check_like_ostream<char>({'a', 'b', 'c'});
+    check_like_ostream<std::string>({"hello", "", "world"});
+
+    {
+        // Strings longer than the buffer, and a separator of several chars.
+        std::ostringstream sout;
+        {
+            ostream_sink sink(sout, " | ", 1);
+            copy(std::vector<std::string>{std::string(100, 'x'), "y"}, sink.out());
+            CHECK(sout.str() == std::string(100, 'x'));
+            sink.flush();
+            CHECK(sout.str() == std::string(100, 'x') + " | y | ");
+        }
+    }
+
+    {
+        std::ostringstream sout;
+        ostream_sink sink(sout, "\n");
+        sink.precision(17);
+        CHECK(sink.precision() == 17);
+        transform(view::ints(1) | view::take(3), sink.out(), [](int i){ return 1.0 / i; });
+        sink.put("end");
+        sink.flush();
+        CHECK(sout.str() == "1\n0.5\n0.33333333333333331\nend");
+    }
+
+    {
+        // A long double keeps its precision beyond a double's.
+        std::ostringstream expected, actual;
+        expected.precision(21);
+        expected << 1.0L / 3;
+        {
+            ostream_sink sink(actual);
+            sink.precision(21);
+            sink.put(1.0L / 3);
+        }
+        CHECK(actual.str() == expected.str());
+    }
+
+    {
+        char const *const path = "utility.sink.tmp";
+        std::FILE *file = std::fopen(path, "wb");
+        CHECK(file != nullptr);
+        {
+            fd_sink sink(fileno(file), " ", 100);
+            copy(view::ints(0) | view::take(10000), sink.out());
+        }
+        std::fclose(file);
+        std::ifstream in(path);
+        std::vector<int> v{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+        CHECK(v.size() == 10000u);
+        CHECK(v.back() == 9999);
+        std::remove(path);
+    }
+
+    return test_result();
+}
@@ -10,7 +10,9 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <list>
+#include <array>
 #include <vector>
+#include <sstream>
 #include <forward_list>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
@@ -18,6 +20,8 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/repeat.hpp>
 #include <range/v3/view/cycle.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/istream_range.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -137,5 +141,62 @@ int main()
         CHECK((next(it,7) - it) == 0);
     }
 
+    {
+        // Contiguous ranges are chunked into ranges of pointers.
+        std::vector<int> vi = view::iota(0,7);
+        auto rng = vi | view::chunk(3);
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, range<int *>>());
+        ::models<concepts::RandomAccessRange>(rng);
+        CHECK(size(rng) == 3u);
+        auto it = begin(rng);
+        range<int *> first = *it, last = it[2];
+        CHECK(first.begin() == vi.data());
+        CHECK(last.end() == vi.data() + 7);
+        ::check_equal(it[1], {3,4,5});
+        ::check_equal(it[2], {6});
+
+        std::array<int, 4> const ai = {{0,1,2,3}};
+        CONCEPT_ASSERT(Same<range_value_t<decltype(ai | view::chunk(2))>,
+            range<int const *>>());
+        auto rng1 = ai | view::chunk(2);
+        ::check_equal(*next(begin(rng1)), {2,3});
+
+        // Other random-access ranges are chunked into subranges.
+        auto rng2 = view::iota(0,7) | view::transform([](int i){return i*2;}) | view::chunk(4);
+        ::models<concepts::RandomAccessRange>(rng2);
+        ::models<concepts::SizedRange>(range_value_t<decltype(rng2)>());
+        ::check_equal(*begin(rng2), {0,2,4,6});
+        ::check_equal(*next(begin(rng2)), {8,10,12});
+    }
+
+    {
+        // Single-pass ranges are chunked without re-reading the input.
+        std::istringstream sin{"0 1 2 3 4 5 6 7 8 9 10"};
+        auto rng = istream<int>(sin) | view::chunk(3);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        auto it = begin(rng);
+        ::check_equal(*it, {0,1,2});
+        ++it;
+        ::check_equal(*it, {3,4,5});
+        // Partially consume a chunk; advancing skips the rest of it.
+        auto inner = *++it;
+        CHECK(*begin(inner) == 6);
+        ++it;
+        ::check_equal(*it, {9,10});
+        CHECK(++it == end(rng));
+
+        std::istringstream sin2{"0 1 2 3 4 5 6"};
+        auto rng3 = istream<int>(sin2) | view::chunk(2);
+        std::vector<int> sizes;
+        RANGES_FOR(auto &&chunk, rng3)
+            sizes.push_back((int)distance(chunk));
+        ::check_equal(sizes, {2,2,2,1});
+
+        std::istringstream sin3{""};
+        auto rng4 = istream<int>(sin3) | view::chunk(2);
+        CHECK(begin(rng4) == end(rng4));
+    }
+
     return ::test_result();
 }
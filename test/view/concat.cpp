@@ -13,6 +13,8 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/concat.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/remove_if.hpp>
 #include <range/v3/algorithm/equal.hpp>
@@ -83,5 +85,28 @@ int main()
         CHECK(equal(view::concat(f_rng0, f_rng1), {0, 2, 4}));
     }
 
+    // Sized random-access segments whose sentinels are not iterators still
+    // support O(1) advance and distance.
+    {
+        auto cat = view::concat(view::iota(0) | view::take_exactly(3),
+            view::iota(3) | view::take_exactly(2), view::iota(5) | view::take_exactly(4));
+        ::models<concepts::RandomAccessView>(cat);
+        ::models<concepts::SizedView>(cat);
+        CHECK(cat.size() == 9u);
+        auto first = cat.begin();
+        auto last = ranges::next(first, cat.end());
+        CHECK((last - first) == 9);
+        CHECK(*(first + 2) == 2);
+        CHECK(*(first + 3) == 3);
+        CHECK(*(first + 7) == 7);
+        CHECK(*(last - 1) == 8);
+        CHECK(*(last - 5) == 4);
+        CHECK(*(last - 9) == 0);
+        CHECK(((first + 7) - (first + 1)) == 6);
+        CHECK(((first + 1) - (first + 7)) == -6);
+        CHECK(((last - 4) - first) == 5);
+        ::check_equal(cat, {0, 1, 2, 3, 4, 5, 6, 7, 8});
+    }
+
     return test_result();
 }
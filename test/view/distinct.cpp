@@ -0,0 +1,69 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/distinct.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+enum class color { red, green, blue };
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{4, 0, 4, 1, -3, 0, 1, 9, -3};
+    auto rng = v | view::distinct;
+    ::models<concepts::InputView>(rng);
+    ::models_not<concepts::ForwardView>(rng);
+    ::check_equal(rng, {4, 0, 1, -3, 9});
+    // Each traversal starts afresh.
+    ::check_equal(rng, {4, 0, 1, -3, 9});
+    CHECK((v | view::distinct | to_vector) == (std::vector<int>{4, 0, 1, -3, 9}));
+
+    // Many keys, so the set grows.
+    auto mod = view::ints(0) | view::transform([](int i){ return (i * 7919) % 5003; })
+        | view::take(20000) | view::distinct;
+    int n = 0;
+    bool ok = true;
+    RANGES_FOR(int i, mod)
+    {
+        ok = ok && i == (n * 7919) % 5003;
+        ++n;
+    }
+    CHECK(ok);
+    CHECK(n == 5003);
+
+    // Projected keys
+    std::vector<std::string> words{"one", "two", "three", "four", "five", "six"};
+    ::check_equal(words | view::distinct(&std::string::size),
+        {"one", "three", "four"});
+
+    // Enumerations and pointers
+    std::vector<color> colors{color::blue, color::red, color::blue, color::green, color::red};
+    ::check_equal(colors | view::distinct, {color::blue, color::red, color::green});
+    int a = 0, b = 0;
+    std::vector<int *> ptrs{&a, nullptr, &b, &a, nullptr};
+    ::check_equal(ptrs | view::distinct, std::vector<int *>{&a, nullptr, &b});
+
+    // Single-pass input
+    std::istringstream sin{"3 1 3 2 1 3"};
+    ::check_equal(istream<int>(sin) | view::distinct, {3, 1, 2});
+
+    return ::test_result();
+}
@@ -0,0 +1,176 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/hash_join.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct customer
+{
+    int id;
+    std::string name;
+};
+
+struct order
+{
+    int customer;
+    int amount;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<customer> customers{{1, "ann"}, {2, "bob"}, {3, "cy"}, {2, "bo"}};
+    std::vector<order> orders{{2, 10}, {4, 20}, {1, 30}, {2, 40}, {3, 50}};
+
+    // Inner join: each order with each customer of its id, in the order of the orders.
+    {
+        auto rng = view::hash_join(customers, orders, &customer::id, &order::customer);
+        ::models<concepts::ForwardView>(rng);
+        ::models_not<concepts::SizedView>(rng);
+        using P = std::pair<std::string, int>;
+        std::vector<P> res;
+        RANGES_FOR(auto &&p, rng)
+        {
+            CHECK(p.first.id == p.second.customer);
+            res.emplace_back(p.first.name, p.second.amount);
+        }
+        ::check_equal(res, std::vector<P>{{"bob", 10}, {"bo", 10}, {"ann", 30},
+            {"bob", 40}, {"bo", 40}, {"cy", 50}});
+        // The elements are those of the ranges, not copies.
+        auto it = rng.begin();
+        CHECK(&(*it).first == &customers[1]);
+        CHECK(&(*it).second == &orders[0]);
+        (*it).second.amount = 11;
+        CHECK(orders[0].amount == 11);
+        orders[0].amount = 10;
+        // Iterating again reuses the table.
+        CHECK(distance(rng) == 6);
+        auto copy = rng;
+        CHECK(distance(copy) == 6);
+    }
+
+    // Left outer join: orders without customers come once, with a null pointer.
+    {
+        auto rng = view::hash_join(customers, orders, &customer::id, &order::customer,
+            left_outer);
+        ::models<concepts::ForwardView>(rng);
+        std::vector<std::pair<int, std::string>> res;
+        RANGES_FOR(auto &&p, rng)
+            res.emplace_back(p.second.amount, p.first ? p.first->name : "-");
+        ::check_equal(res, std::vector<std::pair<int, std::string>>{{10, "bob"}, {10, "bo"},
+            {20, "-"}, {30, "ann"}, {40, "bob"}, {40, "bo"}, {50, "cy"}});
+        std::pair<customer *, order> v = *rng.begin();
+        CHECK(v.first == &customers[1]);
+        CHECK(v.second.amount == 10);
+    }
+
+    // Empty sides.
+    {
+        std::vector<int> none;
+        std::vector<int> some{1, 2, 3};
+        CHECK(empty(view::hash_join(none, some, ident{}, ident{})));
+        CHECK(empty(view::hash_join(some, none, ident{}, ident{})));
+        CHECK(distance(view::hash_join(none, some, ident{}, ident{}, left_outer)) == 3);
+    }
+
+    // Keys of other types, a probe side that is single-pass, and a build side that
+    // is a view with no size.
+    {
+        std::vector<std::string> words{"one", "two", "three", "four", "five"};
+        std::stringstream sin{"three six one one"};
+        auto rng = view::hash_join(words | view::filter([](std::string const &s) {
+                return s.size() > 3;
+            }), istream<std::string>(sin), ident{}, ident{});
+        ::models<concepts::InputView>(rng);
+        ::models_not<concepts::ForwardView>(rng);
+        std::vector<std::string> res;
+        RANGES_FOR(auto &&p, rng)
+            res.push_back(p.first);
+        ::check_equal(res, std::vector<std::string>{"three"});
+    }
+
+    // A build side with many keys, so the table grows, and an infinite probe side.
+    {
+        std::vector<int> build = view::ints(0, 10000) | view::transform([](int i) {
+            return i * 3;
+        });
+        auto rng = view::hash_join(build, view::ints(0), ident{}, ident{});
+        ::models_not<concepts::BoundedView>(rng);
+        std::vector<int> res;
+        RANGES_FOR(auto &&p, rng | view::take(5))
+            res.push_back(p.second);
+        ::check_equal(res, {0, 3, 6, 9, 12});
+
+        std::list<long> probe{29997, 30000, 1};
+        auto rng2 = view::hash_join(build, probe, ident{}, ident{}, left_outer);
+        std::vector<bool> matched;
+        RANGES_FOR(auto &&p, rng2)
+            matched.push_back(p.first != nullptr);
+        ::check_equal(matched, {true, false, false});
+    }
+
+    // A copy made after iterating outlives the original. The build side is a view whose
+    // iterators point into it, so the copy must not use the original's.
+    {
+        std::vector<int> build{1, 2, 3, 2};
+        std::vector<int> probe{2, 4, 3};
+        auto twice = [](int i) { return i * 2; };
+        using Rng = decltype(view::hash_join(build | view::transform(twice), probe, ident{},
+            ident{}));
+        std::vector<Rng> copies;
+        {
+            auto rng = view::hash_join(build | view::transform(twice), probe, ident{},
+                ident{});
+            CHECK(distance(rng) == 3);
+            copies.push_back(rng);
+        }
+        std::vector<std::pair<int, int>> res;
+        RANGES_FOR(auto &&p, copies.front())
+            res.emplace_back(p.first, p.second);
+        ::check_equal(res, std::vector<std::pair<int, int>>{{2, 2}, {4, 4}, {4, 4}});
+    }
+
+    // Copies in several threads build the table they share once between them.
+    {
+        std::vector<int> build = view::ints(0, 50000);
+        std::vector<int> probe = view::ints(0, 100000);
+        auto rng = view::hash_join(build, probe, ident{}, ident{});
+        std::vector<long> sums(4);
+        std::vector<std::thread> threads;
+        for(std::size_t t = 0; t < 4; ++t)
+            threads.emplace_back([&sums, t](decltype(rng) copy)
+            {
+                RANGES_FOR(auto &&p, copy)
+                    sums[t] += p.first;
+            }, rng);
+        for(auto &th : threads)
+            th.join();
+        for(long sum : sums)
+            CHECK(sum == 50000l * 49999 / 2);
+    }
+
+    return ::test_result();
+}
@@ -9,8 +9,12 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <list>
+#include <array>
+#include <thread>
 #include <vector>
 #include <iterator>
+#include <forward_list>
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/view/join.hpp>
@@ -19,6 +23,9 @@
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -83,8 +90,12 @@ int main()
     std::vector<std::string> vs{"This","is","his","face"};
     auto rng3 = view::join(vs);
     static_assert(range_cardinality<decltype(rng3)>::value == ranges::finite, "");
-    models_not<concepts::SizedRange>(rng3);
-    models_not<concepts::SizedIteratorRange>(begin(rng3), end(rng3));
+    models<concepts::RandomAccessRange>(rng3);
+    models<concepts::BoundedRange>(rng3);
+    models<concepts::SizedRange>(rng3);
+    models<concepts::SizedIteratorRange>(begin(rng3), end(rng3));
+    CHECK(rng3.size() == 13u);
+    CHECK((end(rng3) - begin(rng3)) == 13);
     CHECK(to_<std::string>(rng3) == "Thisishisface");
 
     auto rng4 = view::join(vs, ' ');
@@ -106,5 +117,119 @@ int main()
     CHECK(rng6.size() == 4u);
     check_equal(rng6, {42,42,42,42});
 
+    // Joining lvalue ranges is multipass, and random-access when the outer and
+    // inner ranges are sized and random-access.
+    {
+        std::vector<std::vector<int>> vvi{{}, {0,1,2}, {}, {}, {3}, {4,5}, {}};
+        auto rng = vvi | view::join;
+        models<concepts::RandomAccessRange>(rng);
+        models<concepts::BoundedRange>(rng);
+        models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 6u);
+        check_equal(rng, {0,1,2,3,4,5});
+        check_equal(rng | view::reverse, {5,4,3,2,1,0});
+        auto first = begin(rng), last = end(rng);
+        CHECK((last - first) == 6);
+        for(int i = 0; i < 6; ++i)
+        {
+            CHECK(*(first + i) == i);
+            CHECK(*(last - (6 - i)) == i);
+            CHECK(((first + i) - first) == i);
+            CHECK((last - (first + i)) == 6 - i);
+        }
+        CHECK(((first + 4) - (first + 1)) == 3);
+        CHECK(((first + 1) - (first + 4)) == -3);
+        CHECK((first + 6) == last);
+        CHECK((last - 6) == first);
+        CHECK(first[5] == 5);
+
+        // Copies share the offsets once they are built.
+        auto copy = rng;
+        {
+            auto tmp = vvi | view::join;
+            CHECK(begin(tmp)[4] == 4);
+            copy = tmp;
+        }
+        CHECK(begin(copy)[4] == 4);
+        CHECK((end(copy) - begin(copy)) == 6);
+
+        // The offsets are built by the first random access, so the inner ranges
+        // can change size before that.
+        {
+            std::vector<std::vector<int>> vv{{1}, {2, 3}};
+            auto j = vv | view::join;
+            vv[0].push_back(9);
+            CHECK(size(j) == 4u);
+            CHECK((end(j) - begin(j)) == 4);
+            CHECK(begin(j)[1] == 9);
+            check_equal(j, {1, 9, 2, 3});
+        }
+
+        // Threads doing random access on one view build its offsets once between
+        // them.
+        {
+            std::vector<std::vector<int>> big;
+            for(int i = 0; i < 1000; ++i)
+                big.push_back(std::vector<int>(static_cast<std::size_t>(i % 5), i));
+            auto j = big | view::join;
+            std::vector<long> sums(4);
+            std::vector<std::thread> threads;
+            for(std::size_t t = 0; t < 4; ++t)
+                threads.emplace_back([&, t]
+                {
+                    auto const first = begin(j);
+                    auto const n = end(j) - first;
+                    for(auto i = n; i-- != 0;)
+                        sums[t] += first[i];
+                });
+            for(auto &th : threads)
+                th.join();
+            for(long sum : sums)
+                CHECK(sum == accumulate(j, 0l));
+        }
+
+        // Algorithms that need random access work on the joined range.
+        CHECK(is_sorted(vvi | view::join));
+        std::vector<std::vector<int>> unsorted{{5,3}, {}, {4,0,2}, {1}};
+        auto urng = unsorted | view::join;
+        sort(urng);
+        check_equal(urng, {0,1,2,3,4,5});
+        check_equal(unsorted, std::vector<std::vector<int>>{{0,1}, {}, {2,3,4}, {5}});
+    }
+
+    // Inner ranges of fixed size need no table of offsets.
+    {
+        std::vector<std::array<int, 2>> vai{{{0,1}}, {{2,3}}, {{4,5}}};
+        auto rng = vai | view::join;
+        models<concepts::RandomAccessRange>(rng);
+        models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 6u);
+        auto first = begin(rng);
+        CHECK(*(first + 3) == 3);
+        CHECK((end(rng) - (first + 1)) == 5);
+        check_equal(rng | view::reverse, {5,4,3,2,1,0});
+    }
+
+    // Forward and bidirectional inner ranges give forward and bidirectional joins.
+    {
+        std::vector<std::list<int>> vli{{0,1}, {}, {2}};
+        auto rng = vli | view::join;
+        models<concepts::BidirectionalRange>(rng);
+        models_not<concepts::RandomAccessRange>(rng);
+        CHECK(rng.size() == 3u);
+        check_equal(rng | view::reverse, {2,1,0});
+
+        std::forward_list<std::forward_list<int>> fli{{0,1}, {}, {2,3}};
+        auto rng2 = fli | view::join;
+        models<concepts::ForwardRange>(rng2);
+        models_not<concepts::BidirectionalRange>(rng2);
+        models_not<concepts::SizedRange>(rng2);
+        auto it = begin(rng2);
+        auto it2 = it;
+        CHECK(*++it == 1);
+        CHECK(*it2 == 0);
+        check_equal(rng2, {0,1,2,3});
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,101 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <system_error>
+#include <range/v3/core.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/mapped_file.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct record
+{
+    int key;
+    float value;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    char const *const path = "view.mapped_file.tmp";
+    {
+        std::ofstream out(path, std::ios::binary);
+        for(int i = 0; i < 1000; ++i)
+        {
+            record r{i * 2, static_cast<float>(i) / 2};
+            out.write(reinterpret_cast<char const *>(&r), sizeof(r));
+        }
+        out.write("xyz", 3); // A partial record at the end
+    }
+
+    {
+        auto recs = view::mapped_file<record>(path, mapped_file_hint::random);
+        ::models<concepts::SizedView>(recs);
+        ::models<concepts::BoundedView>(recs);
+        ::models<concepts::RandomAccessView>(recs);
+        ::has_type<record const &>(*begin(recs));
+        CHECK(recs.size() == 1000u);
+        CHECK(recs[999].key == 1998);
+        CHECK(recs.data() == &*begin(recs));
+
+        auto it = lower_bound(recs, 1001, less{}, &record::key);
+        CHECK(it->key == 1002);
+        CHECK(it->value == 250.5f);
+        CHECK(count_if(recs, [](record const &r){ return r.value >= 400; }) == 200);
+        CHECK(ranges::distance(recs | view::chunk(300)) == 4);
+
+        // Copies share the mapping.
+        auto copy = recs;
+        recs = {};
+        CHECK(copy[1].key == 2);
+        copy.advise(mapped_file_hint::sequential);
+        CHECK(count_if(copy, [](record const &r){ return r.key % 4 == 0; }) == 500);
+    }
+
+    {
+        auto bytes = view::mapped_file(path, mapped_file_hint::willneed);
+        CHECK(bytes.size() == 1000 * sizeof(record) + 3);
+        CHECK(std::string(bytes.end() - 3, bytes.end()) == "xyz");
+        CHECK(ranges::distance(view::mapped_file<std::uint64_t>(path)) ==
+            static_cast<std::ptrdiff_t>((1000 * sizeof(record) + 3) / 8));
+    }
+
+    std::remove(path);
+
+    {
+        std::ofstream{path};
+        auto empty = view::mapped_file(path);
+        CHECK(empty.size() == 0u);
+        CHECK(empty.begin() == empty.end());
+    }
+
+    std::remove(path);
+
+    bool thrown = false;
+    try
+    {
+        view::mapped_file(path);
+    }
+    catch(std::system_error const &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return ::test_result();
+}
@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/merge_join.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct tick
+{
+    int time;
+    double price;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<tick> ticks{{1, 1.0}, {2, 2.0}, {2, 2.5}, {4, 4.0}, {5, 5.0}, {5, 5.5}, {7, 7.0}};
+    std::list<std::pair<int, std::string>> events{{0, "a"}, {2, "b"}, {3, "c"}, {5, "d"},
+        {5, "e"}, {7, "f"}, {8, "g"}};
+
+    // The runs of each key in both ranges, duplicates on either side included.
+    {
+        auto rng = view::merge_join(ticks, events, ordered_less{}, &tick::time,
+            &std::pair<int, std::string>::first);
+        ::models<concepts::ForwardView>(rng);
+        ::models_not<concepts::BidirectionalView>(rng);
+        std::vector<int> keys;
+        std::vector<std::pair<long, long>> sizes;
+        RANGES_FOR(auto const &runs, rng)
+        {
+            keys.push_back(runs.first.begin()->time);
+            sizes.emplace_back(distance(runs.first), distance(runs.second));
+            RANGES_FOR(auto const &t, runs.first)
+                CHECK(t.time == keys.back());
+            RANGES_FOR(auto const &e, runs.second)
+                CHECK(e.first == keys.back());
+        }
+        ::check_equal(keys, {2, 5, 7});
+        ::check_equal(sizes, std::vector<std::pair<long, long>>{{2, 1}, {2, 2}, {1, 1}});
+        // The runs are views of the ranges, not copies.
+        CHECK(&*(*rng.begin()).first.begin() == &ticks[1]);
+        // And so is the view, when it's const.
+        auto const &crng = rng;
+        CHECK(distance(crng) == 3);
+    }
+
+    // The cross product of the runs, with view::for_each.
+    {
+        auto pairs = view::merge_join(ticks, events, ordered_less{}, &tick::time,
+                &std::pair<int, std::string>::first) |
+            view::for_each([](std::pair<range<std::vector<tick>::iterator>,
+                range<std::list<std::pair<int, std::string>>::iterator>> runs)
+            {
+                return view::for_each(runs.first, [=](tick const &t)
+                {
+                    return runs.second | view::transform(
+                        [=](std::pair<int, std::string> const &e)
+                        {
+                            return std::to_string(t.price).substr(0, 3) + e.second;
+                        });
+                });
+            });
+        ::check_equal(pairs, std::vector<std::string>{"2.0b", "2.5b", "5.0d", "5.0e",
+            "5.5d", "5.5e", "7.0f"});
+    }
+
+    // Ranges sorted by another order, and empty or disjoint ranges.
+    {
+        std::vector<int> a{9, 7, 7, 3, 1};
+        std::vector<int> b{8, 7, 3, 3, 3, 0};
+        std::vector<std::pair<long, long>> sizes;
+        RANGES_FOR(auto const &runs, view::merge_join(a, b, std::greater<int>{}))
+            sizes.emplace_back(distance(runs.first), distance(runs.second));
+        ::check_equal(sizes, std::vector<std::pair<long, long>>{{2, 1}, {1, 3}});
+
+        std::vector<int> none;
+        CHECK(empty(view::merge_join(none, b)));
+        CHECK(empty(view::merge_join(b, none)));
+        std::vector<int> odd{1, 3, 5}, even{0, 2, 4, 6};
+        CHECK(empty(view::merge_join(odd, even)));
+    }
+
+    // An infinite range joined with a finite one.
+    {
+        std::vector<int> squares{0, 1, 4, 9, 16, 25};
+        std::vector<int> keys;
+        RANGES_FOR(auto const &runs, view::merge_join(view::ints(0), squares))
+            keys.push_back(*runs.first.begin());
+        ::check_equal(keys, squares);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,127 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/view/parse.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+template<typename T>
+bool throws(std::string const &str)
+{
+    try
+    {
+        ranges::accumulate(ranges::view::parse<T>(str), T{});
+    }
+    catch(std::invalid_argument const &)
+    {
+        return true;
+    }
+    catch(std::out_of_range const &)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::string const str{"  1 -22\t+333\n4444\r\n  -2147483648 2147483647  "};
+        auto ints = view::parse<int>(str);
+        ::models<concepts::BoundedView>(ints);
+        ::models<concepts::ForwardView>(ints);
+        ::has_type<int>(*begin(ints));
+        ::check_equal(ints, {1, -22, 333, 4444, std::numeric_limits<int>::min(),
+            std::numeric_limits<int>::max()});
+        CHECK(accumulate(ints, 0LL) == 1LL - 22 + 333 + 4444 - 1);
+    }
+
+    {
+        std::string const str{"18446744073709551615,0,,7"};
+        ::check_equal(view::parse<std::uint64_t>(str, ","),
+            {std::numeric_limits<std::uint64_t>::max(), std::uint64_t(0), std::uint64_t(7)});
+        std::string const empty;
+        CHECK(ranges::distance(view::parse<int>(empty)) == 0);
+    }
+
+    {
+        std::string const str{"1.5 -0.25 3e2 .5 6. 1e-3 0.1 123456789.123 1e300 "
+            "12345678901234567890.5 nan 2.5E+1"};
+        std::vector<double> v = view::parse<double>(str);
+        CHECK(v.size() == 12u);
+        CHECK(v[0] == 1.5);
+        CHECK(v[1] == -0.25);
+        CHECK(v[2] == 300.0);
+        CHECK(v[3] == 0.5);
+        CHECK(v[4] == 6.0);
+        CHECK(v[5] == 1e-3);
+        CHECK(v[6] == 0.1);
+        CHECK(v[7] == 123456789.123);
+        CHECK(v[8] == 1e300);
+        CHECK(v[9] == 12345678901234567890.5);
+        CHECK(v[10] != v[10]);
+        CHECK(v[11] == 25.0);
+        std::string const f{"0.1 2.5"};
+        ::check_equal(view::parse<float>(f), {0.1f, 2.5f});
+        // Rounded once, to float, and not to double first: the double nearest this
+        // is halfway between two floats.
+        std::string const tie{"1.00000005960464477550 16777217 7.038531e-26"};
+        ::check_equal(view::parse<float>(tie), {1.00000005960464477550f, 16777217.0f,
+            7.038531e-26f});
+    }
+
+    CHECK(throws<int>("12 x3"));
+    CHECK(throws<int>("2147483648"));
+    CHECK(throws<int>("-"));
+    CHECK(throws<unsigned>("-1"));
+    CHECK(throws<std::int8_t>("128"));
+    CHECK(!throws<std::int8_t>("-128"));
+    CHECK(throws<double>("1e+"));
+    CHECK(throws<double>("1.2.3"));
+    CHECK(throws<double>("1e999"));
+    CHECK(throws<float>("1e39"));
+    CHECK(throws<float>("-3.5e38"));
+    CHECK(!throws<float>("3.4e38"));
+    CHECK(!throws<float>("1e-50"));
+
+    // Pieces start and end at delimiters, and parse the same numbers between them.
+    {
+        std::string str;
+        for(int i = 0; i < 1000; ++i)
+            str += std::to_string(i * 37) + (i % 7 ? " " : "\n");
+        auto all = view::parse<long>(str);
+        for(std::size_t n : {1u, 2u, 3u, 8u, 5000u})
+        {
+            auto parts = all.partition(n);
+            CHECK(parts.size() <= n);
+            std::vector<long> v;
+            for(auto const &part : parts)
+                for(long l : part)
+                    v.push_back(l);
+            ::check_equal(v, all);
+        }
+        // No pieces is taken as one, rather than dropping the numbers.
+        auto parts = all.partition(0);
+        CHECK(parts.size() == 1u);
+        ::check_equal(parts.front(), all);
+    }
+
+    return ::test_result();
+}
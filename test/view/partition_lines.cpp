@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/partition_lines.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+std::vector<std::string> lines_of(partition_lines_view const &parts)
+{
+    std::vector<std::string> lines;
+    RANGES_FOR(auto const &part, parts)
+    {
+        RANGES_FOR(auto const &line, getlines(part))
+            lines.push_back(line);
+    }
+    return lines;
+}
+
+int main()
+{
+    std::string const text = "one\ntwo\nthree\nfour\nfive\nsix\nseven\neight\nnine\nten\n";
+    std::vector<std::string> const lines = lines_of(view::partition_lines(text, 1));
+    CHECK(lines.size() == 10u);
+    CHECK(lines.front() == "one");
+    CHECK(lines.back() == "ten");
+
+    for(std::size_t n = 1; n <= text.size() + 2; ++n)
+    {
+        auto parts = view::partition_lines(text, n);
+        models<concepts::RandomAccessRange>(parts);
+        models<concepts::SizedRange>(parts);
+        CHECK(size(parts) == n);
+        // The pieces cover the text exactly, and each ends with a whole line.
+        CHECK((parts | view::join | to_<std::string>()) == text);
+        RANGES_FOR(auto const &part, parts)
+            CHECK((empty(part) || '\n' == *prev(end(part))));
+        CHECK(lines_of(parts) == lines);
+    }
+
+    {
+        // Cuts that land at the start of a line stay there.
+        std::string const abc = "ab\ncd\n";
+        auto parts = view::partition_lines(abc, 2);
+        CHECK(std::string(parts[0].begin(), parts[0].end()) == "ab\n");
+        CHECK(std::string(parts[1].begin(), parts[1].end()) == "cd\n");
+        auto last = *prev(end(parts));
+        CHECK(std::string(last.begin(), last.end()) == "cd\n");
+    }
+
+    {
+        // A last line without a delimiter, and a line longer than a piece.
+        std::string const str = "x;a very long line;y";
+        auto parts = view::partition_lines(str, 4, ';');
+        std::vector<std::string> pieces;
+        RANGES_FOR(auto const &part, parts)
+            pieces.push_back(std::string(part.begin(), part.end()));
+        CHECK(pieces.size() == 4u);
+        CHECK(pieces[0] == "x;a very long line;");
+        CHECK(pieces[1] == "");
+        CHECK(pieces[2] == "");
+        CHECK(pieces[3] == "y");
+    }
+
+    {
+        std::string const empty_str;
+        CHECK(size(view::partition_lines(empty_str, 8)) == 0u);
+        std::vector<char> const buf = {'a', '\n', 'b'};
+        CHECK(size(view::partition_lines(buf, 2)) == 2u);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,100 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <thread>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/cycle.hpp>
+#include <range/v3/view/drop_while.hpp>
+#include <range/v3/view/prepare.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/slice.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> vi{1,2,3,4,5,6,7,8,9,10};
+
+    // The begin of a remove_if view is found once, when the view is prepared.
+    {
+        int calls = 0;
+        auto odd = vi | view::remove_if([&](int i){ return ++calls, i % 2 == 0; });
+        CONCEPT_ASSERT(!Range<decltype(odd) const>());
+        auto const rng = odd | view::prepare;
+        ::models<concepts::BoundedView>(rng);
+        ::models<concepts::BidirectionalIterator>(rng.begin());
+        CHECK(calls == 1);
+        auto const copy = rng;
+        CHECK(rng.begin() == copy.begin());
+        CHECK(calls == 1);
+        ::check_equal(rng, {1,3,5,7,9});
+        ::check_equal(copy, {1,3,5,7,9});
+        ::check_equal(rng | view::reverse, {9,7,5,3,1});
+    }
+
+    {
+        std::list<int> li{1,2,3,4,5};
+        auto const rng = li | view::drop_while([](int i){ return i < 3; }) | view::prepare;
+        ::models_not<concepts::SizedView>(rng);
+        ::check_equal(rng, {3,4,5});
+        ::check_equal(rng, {3,4,5});
+
+        auto const rev = li | view::reverse | view::prepare;
+        ::check_equal(rev, {5,4,3,2,1});
+    }
+
+    {
+        auto const rng = vi | view::slice(2, 5) | view::prepare;
+        ::models<concepts::RandomAccessView>(rng);
+        ::models<concepts::SizedView>(rng);
+        CHECK(rng.size() == 3u);
+        CHECK(rng[1] == 4);
+        ::check_equal(rng, {3,4,5});
+
+        auto const cyc = vi | view::take(3) | view::cycle | view::prepare;
+        ::check_equal(cyc | view::take(7), {1,2,3,1,2,3,1});
+    }
+
+    // Threads iterating a prepared cycle of a range whose end is a sentinel, also
+    // through an adaptor. The end is found when the view is prepared, so they don't
+    // write to the view.
+    {
+        auto const head = vi | view::take_while([](int i){ return i < 4; });
+        ::models_not<concepts::BoundedView>(head);
+        auto const cyc = head | view::cycle | view::prepare;
+        auto const taken = head | view::cycle | view::take(10) | view::prepare;
+        std::vector<int> sums(8);
+        std::vector<std::thread> threads;
+        for(std::size_t t = 0; t < 4; ++t)
+            threads.emplace_back([&, t]
+            {
+                sums[2 * t] = accumulate(cyc | view::take(1000), 0);
+                sums[2 * t + 1] = accumulate(taken, 0);
+            });
+        for(auto &th : threads)
+            th.join();
+        for(std::size_t t = 0; t < 4; ++t)
+        {
+            CHECK(sums[2 * t] == 1999);
+            CHECK(sums[2 * t + 1] == 19);
+        }
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,121 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/records.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct record
+{
+    int key;
+    float value;
+};
+
+// Trivially copyable, but not POD.
+struct point
+{
+    int x = 1;
+    int y = 2;
+    point() = default;
+    point(int x_, int y_) : x(x_), y(y_) {}
+};
+
+using namespace ranges;
+
+int main()
+{
+    auto make_record = [](int i){ return record{i, static_cast<float>(i) / 4}; };
+    char const *const path = "view.records.tmp";
+    {
+        std::FILE *file = std::fopen(path, "wb");
+        CHECK(file != nullptr);
+        {
+            fd_sink sink(fileno(file), nullptr, 100);
+            auto out = records_out<record>(sink);
+            ::models<concepts::WeakOutputIterator>(records_out<record>(sink), record{});
+            copy(view::ints(0) | view::take(100000) | view::transform(make_record), out);
+            sink.write("xyz", 3); // A partial record at the end
+        }
+        std::fclose(file);
+    }
+
+    for(std::size_t block_size : {std::size_t(1) << 20, std::size_t(100), std::size_t(1)})
+    {
+        std::ifstream in(path, std::ios::binary);
+        auto recs = view::records<record>(in, block_size);
+        ::models<concepts::InputView>(recs);
+        ::models_not<concepts::ForwardRange>(recs);
+        ::has_type<record const &>(*begin(recs));
+        int i = 0;
+        bool ok = true;
+        RANGES_FOR(record const &r, recs)
+        {
+            ok = ok && r.key == i && r.value == static_cast<float>(i) / 4;
+            ++i;
+        }
+        CHECK(ok);
+        CHECK(i == 100000);
+    }
+
+    {
+        std::FILE *file = std::fopen(path, "rb");
+        CHECK(file != nullptr);
+        auto recs = view::records<record>(fileno(file), 4096);
+        CHECK(count_if(recs, [](record const &r){ return r.key % 3 == 0; }) == 33334);
+        std::fclose(file);
+    }
+
+    {
+        // Round trip through a stream.
+        std::stringstream str;
+        {
+            ostream_sink sink(str);
+            copy(view::ints(0) | view::take(10) | view::transform(make_record),
+                records_out<record>(sink));
+        }
+        CHECK(str.str().size() == 10 * sizeof(record));
+        auto recs = view::records<record>(str, 3 * sizeof(record));
+        CHECK(accumulate(recs, 0, plus{}, &record::key) == 45);
+        CHECK(begin(recs) == end(recs));
+    }
+
+    {
+        std::stringstream str;
+        {
+            ostream_sink sink(str);
+            copy(view::ints(0) | view::take(5) | view::transform([](int i) {
+                return point{i, i * i};
+            }), records_out<point>(sink));
+        }
+        auto recs = view::records<point>(str, 2 * sizeof(point));
+        ::check_equal(recs | view::transform(&point::y), {0, 1, 4, 9, 16});
+    }
+
+    {
+        std::istringstream empty;
+        auto recs = view::records<record>(empty);
+        CHECK(begin(recs) == end(recs));
+    }
+
+    std::remove(path);
+    return test_result();
+}
@@ -10,14 +10,17 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <list>
+#include <functional>
 #include <vector>
 #include <sstream>
 #include <range/v3/core.hpp>
 #include <range/v3/istream_range.hpp>
 #include <range/v3/view/stride.hpp>
+#include <range/v3/view/iota.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/utility/iterator.hpp>
+#include <range/v3/for_each_while.hpp>
 #include <range/v3/numeric.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -64,5 +67,26 @@ int main()
     CHECK((it0 - it0) == 0);
     CHECK((it1 - it1) == 0);
 
+    // Strides over sized ranges keep their offset in a plain integer, and
+    // random-access ones push their elements by index.
+    {
+        using I = range_iterator_t<decltype(v | view::stride(3))>;
+        CONCEPT_ASSERT(std::is_trivially_copyable<I>());
+        CONCEPT_ASSERT(HasForEachWhile<decltype(v | view::stride(3)), std::function<bool(int)>>());
+        CHECK(accumulate(v | view::stride(4), 0) == 0+4+8+12+16+20+24+28+32+36+40+44+48);
+        CHECK(accumulate(view::iota(0, 7) | view::stride(7), 0) == 0);
+        CHECK(accumulate(view::iota(0, 0) | view::stride(2), 0) == 0);
+
+        std::vector<int> out;
+        auto sink = [&](int i){ out.push_back(i); return out.size() != 3u; };
+        CHECK(!for_each_while(v | view::stride(5), sink));
+        ::check_equal(out, {0, 5, 10});
+
+        auto x3 = li | view::stride(4);
+        auto it = ranges::next(x3.begin(), x3.end());
+        CHECK(*--it == 48);
+        CHECK(*--it == 44);
+    }
+
     return ::test_result();
 }
@@ -1,5 +1,10 @@
+#include <random>
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/tokenize.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/to_container.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -33,5 +38,75 @@ int main()
     // ::models<concepts::View>(rng);
     // ::models<concepts::View>(crng);
 
+    // The DFA engine takes the same pipeline and hands out subranges.
+    {
+        auto to_string = view::transform([](range<std::string::const_iterator> t)
+        {
+            return std::string(t.begin(), t.end());
+        });
+        std::string const ctxt{txt};
+        dfa_regex const drx{R"(\w+)"};
+        auto drng = ctxt | view::tokenize(drx);
+        ::models<concepts::BoundedView>(drng);
+        ::models<concepts::ForwardView>(drng);
+        ::models_not<concepts::BidirectionalView>(drng);
+        ::has_type<range<std::string::const_iterator>>(*ranges::begin(drng));
+        ::check_equal(drng | to_string, {"abc","def","ghi"});
+        ::check_equal(view::tokenize(ctxt, drx, -1) | to_string, {"","\n","\t"});
+
+        std::string const log{"GET /index.html 200 1534\nPOST /api 404 12.5"};
+        ::check_equal(view::tokenize(log, dfa_regex{R"([0-9]+(\.[0-9]+)?|[A-Z]+)"}) | to_string,
+            {"GET","200","1534","POST","404","12.5"});
+        ::check_equal(view::tokenize(log, dfa_regex{"[ \n]+"}, -1) | to_string,
+            {"GET","/index.html","200","1534","POST","/api","404","12.5"});
+
+        // Matches are leftmost-longest, and empty matches are skipped.
+        std::string const abs{"ab abab ababab"};
+        ::check_equal(view::tokenize(abs, dfa_regex{"(ab){2,3}"}) | to_string,
+            {"abab","ababab"});
+        CHECK(ranges::distance(view::tokenize(ctxt, dfa_regex{"x*"})) == 0);
+        std::string const empty;
+        CHECK(ranges::distance(view::tokenize(empty, drx, -1)) == 0);
+
+        bool thrown = false;
+        try { dfa_regex{"a(b"}; }
+        catch(std::regex_error const &e) { thrown = e.code() == std::regex_constants::error_paren; }
+        CHECK(thrown);
+        thrown = false;
+        try { dfa_regex{"(a)\\1"}; }
+        catch(std::regex_error const &) { thrown = true; }
+        CHECK(thrown);
+    }
+
+    // A search reads the text once, so a long text with no match takes linear time,
+    // and finds what trying each position in turn finds.
+    {
+        std::string const as(1 << 20, 'a');
+        CHECK(ranges::distance(view::tokenize(as, dfa_regex{"[a-z]+@"})) == 0);
+
+        std::vector<std::string> const patterns{"abcd|c", "a|a[^@]*@", "(ab){2,3}",
+            "[a-z]+@", "x*y", "(a|b)*c(a|b)*", R"(\w+(\.\w+)*)", "ab?c|b", "c*", ".a.",
+            "(a|ab)(c|bcd)", "@?", "b{2,}|ab", "a{17}b"};
+        std::string const chars{"abc@."};
+        std::minstd_rand gen;
+        for(auto const &pattern : patterns)
+        {
+            dfa_regex const drx{pattern};
+            for(int i = 0; i < 300; ++i)
+            {
+                std::string text(gen() % 24, ' ');
+                for(auto &c : text)
+                    c = chars[gen() % chars.size()];
+                auto first = text.cbegin();
+                auto const last = text.cend();
+                while(first != last && drx.match(first, last) == first)
+                    ++first;
+                auto const m = drx.search(text.cbegin(), last);
+                CHECK(m.first == first);
+                CHECK(m.second == drx.match(first, last));
+            }
+        }
+    }
+
     return test_result();
 }
@@ -12,6 +12,7 @@
 #include <cstring>
 #include <string>
 #include <vector>
+#include <list>
 #include <sstream>
 #include <memory>
 #include <range/v3/core.hpp>
@@ -22,6 +23,9 @@
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/bounded.hpp>
 #include <range/v3/view/transform.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/utility/iterator.hpp>
@@ -244,5 +248,33 @@ int main()
 #endif
     }
 
+    // Zips of sized random-access ranges are traversed with a single index.
+    {
+        std::vector<int> a{3,1,2,0};
+        std::vector<double> b{0.5, 1.5, 2.5};
+        std::vector<long> c{10,20,30,40,50};
+        auto z = view::zip(a, b, c);
+        ::models<concepts::RandomAccessRange>(z);
+        ::models<concepts::SizedRange>(z);
+        ::models<concepts::BoundedRange>(z);
+        CHECK(z.size() == 3u);
+        auto first = z.begin(), last = z.end();
+        CHECK((last - first) == 3);
+        CHECK(std::get<2>(first[2]) == 30);
+        CHECK(first.index() == 0);
+        CHECK(std::get<1>((first + 2).bases()) == b.begin() + 2);
+        CHECK(&*std::get<0>(next(first).bases()) == a.data() + 1);
+        CHECK(accumulate(view::zip_with([](int x, double y){ return x * y; }, a, b), 0.0) == 8.0);
+        check_equal(view::zip(a, c) | view::reverse,
+            std::vector<std::pair<int, long>>{{0,40},{2,30},{1,20},{3,10}});
+
+        sort(view::zip(a, c));
+        check_equal(a, {0,1,2,3});
+        check_equal(c, {40,20,30,10,50});
+
+        std::list<int> l{1,2,3};
+        check_equal(view::zip(l, a), std::vector<std::pair<int, int>>{{1,0},{2,1},{3,2}});
+    }
+
     return test_result();
 }